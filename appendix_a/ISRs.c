@@ -13,14 +13,33 @@
 #include "fft.h"
 #include "waveforms.h"
 #include "dtfm.h"
-
-#pragma DATA_SECTION (buffer, "CE0"); // allocate buffers in SDRAM
+#include "decoder.h"
+#include "profile.h"
+#include "tones.h"
+#include "placement.h"
+#include "cpu_load.h"
+#include "deadline.h"
+#include "load_inject.h"
+
+PLACE_HOT(buffer)
+#pragma DATA_ALIGN (buffer, CACHE_LINE_BYTES); // frames own their cache lines
 Int16 buffer[NUM_BUFFERS][BUFFER_LENGTH];
 
+// The EDMA does not see the caches. Frames in cached SDRAM are
+// invalidated before the CPU reads them and written back after it
+// writes them; L2 SRAM is kept coherent with L1D by the hardware.
+#if MEMORY_PLACEMENT == PLACEMENT_SDRAM && CACHE_SDRAM
+#define FRAME_INVALIDATE(frame)	Cache_Invalidate(frame, BUFFER_LENGTH * sizeof(Int16))
+#define FRAME_WRITEBACK(frame)	Cache_Writeback(frame, BUFFER_LENGTH * sizeof(Int16))
+#else
+#define FRAME_INVALIDATE(frame)	((void)0)
+#define FRAME_WRITEBACK(frame)	((void)0)
+#endif
+
 // there are 3 buffers in use at all times, one being filled from the McBSP,
 // one being operated on, and one being emptied to the McBSP
 // ready_index --> buffer ready for processing
-volatile Int16 buffer_ready = 0, over_run = 0, ready_index = 0;
+volatile Int16 buffer_ready = 0, ready_index = 0;
 
 // values used for EDMA channel initialization
 #define EDMA_CONFIG_RX_OPTION				0x00100000	// TCINTEN, event 0
@@ -36,15 +55,31 @@ volatile Int16 buffer_ready = 0, over_run = 0, ready_index = 0;
 
 extern COMPLEX Twiddle_Factors[];
 
-#pragma DATA_SECTION (Input_Total, "CE0"); // allocate buffers in SDRAM
-static COMPLEX Input_Total[BUFFER_COUNT] = { 0 }; // Summed left & right inputs
+// CPU budget: everything ProcessBuffer does per frame, the tone rendering
+// part of it, and the time between EDMA frames it has to fit in
+cycle_stats_t frame_cycles = { 0 };
+cycle_stats_t render_cycles = { 0 };
+volatile uint32_t frame_period = 0;
+static uint32_t last_frame_time = 0;
+
+// Busy and idle cycles per frame, from the time WaitForBuffer sleeps
+cpu_load_t cpu_load;
 
-#pragma DATA_SECTION (Output_Magnitude_Total, "CE0"); // allocate buffers in SDRAM
-static float Output_Magnitude_Total[BUFFER_COUNT] = { 0 };
+// Each frame against its deadline, the next EDMA interrupt: headroom
+// histogram, late and over_run counts, slowest frame by zone. Valid
+// from reset, as BenchmarkCaches processes frames before EDMA_Init.
+#define FRAME_PERIOD_CYCLES(rate)	((uint32_t)((float)CPU_CLOCK_HZ * BUFFER_COUNT / (rate)))
+deadline_t frame_deadline = {
+  FRAME_PERIOD_CYCLES(CODEC_FREQUENCY), FRAME_PERIOD_CYCLES(CODEC_FREQUENCY) / DEADLINE_BINS
+};
 
-uint16_t max_peak = 0;
+// Synthetic load burnt at the end of every frame (LOAD_INJECT in
+// config.h). Left all zero, and so idle, until EDMA_Init.
+load_inject_t frame_load;
 
-char detected_char = '0';
+// ProcessBuffer timed at boot with the caches off and on
+cycle_stats_t cache_off_cycles = { 0 };
+cycle_stats_t cache_on_cycles = { 0 };
 
 /* ENCODER GLOBALS */
 #define LEFT  0
@@ -58,8 +93,21 @@ volatile union {
 /* add any global variables here */
 static float output_frequencies[NUM_OUTPUT_FREQS] = {1000.0, 1300.0};
 static float running_waveform_indices[NUM_OUTPUT_FREQS] = { 0.0 };
+// LUT indices to advance per sample, set by SetEncoderRate
+static float waveform_step_sizes[NUM_OUTPUT_FREQS] = {
+  1000.0 * MAX_WAVEFORM_INDEX / CODEC_FREQUENCY,
+  1300.0 * MAX_WAVEFORM_INDEX / CODEC_FREQUENCY
+};
 static float output_gain = 15000;
 
+// Tick counter the synthetic load is burnt against
+PLACE_RT_CODE(cycle_clock)
+static uint32_t cycle_clock(void)
+{
+  return PROFILE_NOW();
+}
+
+PLACE_INIT_CODE(EDMA_Init)
 void EDMA_Init()
 ////////////////////////////////////////////////////////////////////////
 // Purpose:   Configure EDMA controller to perform all McASP servicing.
@@ -70,14 +118,15 @@ void EDMA_Init()
 //            The EDMA completion interrupt occurs when a buffer has been filled
 //            by the EDMA from the McASP.
 //            The EDMA interrupt service routine updates the ready buffer index,
-//            and sets the buffer ready flag which is being polled by the main
-//            program loop
+//            and sets the buffer ready flag the main program loop sleeps on
+//            in WaitForBuffer
 //
 // Input:     None
 //
 // Returns:   Nothing
 //
-// Calls:     Nothing
+// Calls:     init_cpu_load, init_deadline, init_load_inject,
+//            load_inject_sweep
 //
 // Notes:     None
 ///////////////////////////////////////////////////////////////////////
@@ -170,8 +219,20 @@ void EDMA_Init()
   *(volatile Uint32 *)EDMA3_0_CC_EESR = EDMA_CONFIG_EVENT_MASK;	// enable events
   *(volatile Uint32 *)EDMA3_0_CC_DRAE1 = EDMA_CONFIG_EVENT_MASK;	// enable events for region 1
   *(volatile Uint32 *)EDMA3_0_CC_IESR = EDMA_CONFIG_INTERRUPT_MASK;	// enable CPU interrupt
+
+  // utilisation is counted from the first frame on
+  init_cpu_load(&cpu_load, PROFILE_NOW());
+  init_deadline(&frame_deadline, FRAME_PERIOD_CYCLES(CODEC_FREQUENCY));
+#if LOAD_INJECT != LOAD_OFF
+  init_load_inject(&frame_load, cycle_clock, LOAD_CYCLES, LOAD_JITTER, LOAD_JITTER_CYCLES);
+#endif
+#if LOAD_INJECT == LOAD_SWEEP
+  load_inject_sweep(&frame_load, FRAME_PERIOD_CYCLES(CODEC_FREQUENCY) / LOAD_SWEEP_STEPS,
+		    LOAD_SWEEP_FRAMES, frame_deadline.over_runs);
+#endif
 }
 
+PLACE_INIT_CODE(ZeroBuffers)
 void ZeroBuffers()
 ////////////////////////////////////////////////////////////////////////
 // Purpose:   Sets all buffer locations to 0
@@ -190,106 +251,59 @@ void ZeroBuffers()
 
   while(i--)
     *p++ = 0;
+
+  FRAME_WRITEBACK(buffer[0]);
+  FRAME_WRITEBACK(buffer[1]);
+  FRAME_WRITEBACK(buffer[2]);
 }
 
+PLACE_RT_CODE(ProcessBuffer)
 void ProcessBuffer(COMPLEX *twiddle_factors)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Processes the data in buffer[ready_index] and stores
 //		  the results back into the buffer
 //            Data is packed into the buffer, alternating right/left
 //
-// Input:     None
+// Input:     twiddle_factors - FFT_LENGTH twiddle factors
 //
 // Returns:   Nothing
 //
-// Calls:     Nothing
+// Calls:     DecodeFrame, tones_render, load_inject_frame,
+//            deadline_start, deadline_zone, deadline_end
 //
-// Notes:     None
+// Notes:     In the loopback build the buffer is overwritten with the
+//            tone pattern after decoding, and the EDMA sends it out
+//            two frames later. EDMA_ISR has already invalidated it.
 ///////////////////////////////////////////////////////////////////////
 {
-  Int16 *pBuf = buffer[ready_index];
-  Int32 i;
-
-  // Used for peak finding
-  uint16_t num_peaks = 0;
-  uint16_t peakIndices[BUFFER_COUNT/2] = { 0 };
-
-  float real_component, imag_component;
+  uint32_t frame_start = PROFILE_NOW();
+#ifdef LOOPBACK
+  uint32_t start;
+#endif
 
+  deadline_start(&frame_deadline, frame_start);
   WriteDigitalOutputs(0); // set digital outputs low - for time measurement
 
-  // Extract data from signal
-  for(i = 0;i < BUFFER_COUNT;i++) { // extract data to float buffers
-
-    // Sum left and right signal
-    /* Input_Total[i].re = *pBuf + *(pBuf + 1); */
-
-    Input_Total[i].re = *pBuf;
-    Input_Total[i].im = 0.0;
-
-    pBuf++;
-    pBuf++;
-  }
-
-
-  /********* END PRE FFT *********/
-
-  // Compute FFT's
-  fft_c(BUFFER_COUNT, Input_Total, twiddle_factors);  // Input Total
+  DecodeFrame(buffer[ready_index], BUFFER_COUNT, twiddle_factors);
+  deadline_zone(&frame_deadline, DEADLINE_ZONE_DECODE, PROFILE_NOW());
 
-  /********* BEGIN POST FFT *********/
+#ifdef LOOPBACK
+  start = PROFILE_NOW();
+  tones_render(buffer[ready_index], BUFFER_COUNT);
+  FRAME_WRITEBACK(buffer[ready_index]);
+  PROFILE_RECORD(render_cycles, start);
+  deadline_zone(&frame_deadline, DEADLINE_ZONE_RENDER, PROFILE_NOW());
+#endif
 
-  // Calculate magnitudes of FFT
-  for(i = 0;i < BUFFER_COUNT;i++) {
-    real_component = Input_Total[i].re * Input_Total[i].re;
-    imag_component = Input_Total[i].im * Input_Total[i].im;
-    Output_Magnitude_Total[i] = pow( real_component + imag_component, 0.5);
-  }
-
-  // Find all peaks (Identified by being greater than both neighboring magnitudes
-  for(i=1; i < BUFFER_COUNT/2; i++) {
-    if(Output_Magnitude_Total[i] > Output_Magnitude_Total[i-1] && Output_Magnitude_Total[i] > Output_Magnitude_Total[i+1]) {
-      peakIndices[num_peaks] = i;
-      num_peaks += 1;
-    }
-  }
-
-  uint16_t j = 0;
-  float localMax = 0;
-  uint16_t localMaxIndex = 0;
-  uint16_t localMaxTemp = 0;
-
-  // Bubble sort... cause it's quick and simple... to write...
-  for(j=0; j < num_peaks; j++) {
-    localMax = 0;
-    localMaxIndex = 0;
-
-    // Find max
-    for(i=j; i < num_peaks; i++) {
-      if(Output_Magnitude_Total[peakIndices[i]] > localMax) {
-	localMax = Output_Magnitude_Total[peakIndices[i]];
-	localMaxIndex = i;
-      }
-    }
-
-    // Swap with jth item
-    localMaxTemp = peakIndices[j];
-    peakIndices[j] = peakIndices[localMaxIndex];
-    peakIndices[localMaxIndex] = localMaxTemp;
-  }
-
-  if(peakIndices[0] != max_peak) {
-    max_peak = peakIndices[0];
-    /* printf("New peak index detected: %d\n", max_peak); */
-  }
-
-  float dtfm_freq_one = peakIndices[0] * (SAMPLING_FREQUENCY / NUM_FFT_SAMPLES);
-  float dtfm_freq_two = peakIndices[1] * (SAMPLING_FREQUENCY / NUM_FFT_SAMPLES);
-
-  detected_char = determine_character(dtfm_freq_one, dtfm_freq_two);
+#if LOAD_INJECT != LOAD_OFF
+  load_inject_frame(&frame_load, frame_deadline.over_runs);
+  deadline_zone(&frame_deadline, DEADLINE_ZONE_LOAD, PROFILE_NOW());
+#endif
 
   /* Your code should be done by here */
   WriteDigitalOutputs(1); // set digital output bit 0 high - for time measurement
+  PROFILE_RECORD(frame_cycles, frame_start);
+  deadline_end(&frame_deadline, PROFILE_NOW());
   buffer_ready = 0; // signal we are done
 }
 
@@ -304,27 +318,82 @@ void ProcessBuffer(COMPLEX *twiddle_factors)
 //
 // Notes:     None
 ///////////////////////////////////////////////////////////////////////
+PLACE_RT_CODE(IsBufferReady)
 int IsBufferReady()
 {
   return buffer_ready;
 }
 
+PLACE_RT_CODE(WaitForBuffer)
+void WaitForBuffer()
 ///////////////////////////////////////////////////////////////////////
-// Purpose:   Access function for buffer overrun flag
+// Purpose:   Sleeps until EDMA_ISR marks a buffer ready
 //
 // Input:     None
 //
-// Returns:   Non-zero if a buffer overrun has occurred
+// Returns:   Nothing
+//
+// Calls:     cpu_load_idle, cpu_load_frame
+//
+// Notes:     The flag is tested with interrupts disabled and IDLE is
+//            entered without re-enabling them. An enabled interrupt
+//            still ends IDLE, and is taken once they are restored, so
+//            a frame that completes just before IDLE cannot be slept
+//            through. Other interrupts (UART2) wake the loop too; it
+//            goes back to sleep. Time in IDLE counts as idle in
+//            cpu_load, everything else, ISRs included, as busy.
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t gie, start;
+
+  for(;;) {
+    gie = _disable_interrupts();
+    if(buffer_ready) {
+      _restore_interrupts(gie);
+      break;
+    }
+    start = PROFILE_NOW();
+    asm(" IDLE");
+    cpu_load_idle(&cpu_load, PROFILE_NOW() - start);
+    _restore_interrupts(gie);
+  }
+
+  cpu_load_frame(&cpu_load, PROFILE_NOW());
+}
+
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Access function for the buffer overrun count
+//
+// Input:     None
+//
+// Returns:   Frames that were still waiting when the next one arrived
 //
 // Calls:     Nothing
 //
-// Notes:     None
+// Notes:     The rest of the deadline statistics are in frame_deadline
 ///////////////////////////////////////////////////////////////////////
 int IsOverRun()
 {
-  return over_run;
+  return frame_deadline.over_runs;
+}
+
+void SetDeadlineRate(float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Moves the frame deadline to a new sample rate
+//
+// Input:     sample_rate - new sample rate in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     deadline_set_period
+//
+// Notes:     Restarts the headroom histogram and worst-frame trace
+///////////////////////////////////////////////////////////////////////
+{
+  deadline_set_period(&frame_deadline, FRAME_PERIOD_CYCLES(sample_rate));
 }
 
+PLACE_RT_CODE(EDMA_ISR)
 interrupt void EDMA_ISR()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   EDMA interrupt service routine.  Invoked on every buffer
@@ -334,19 +403,100 @@ interrupt void EDMA_ISR()
 //
 // Returns:   Nothing
 //
-// Calls:     Nothing
+// Calls:     deadline_isr
 //
-// Notes:     None
+// Notes:     Also measures the frame period for the CPU budget
 ///////////////////////////////////////////////////////////////////////
 {
+  uint32_t now = PROFILE_NOW();
+
+  frame_period = now - last_frame_time;
+  last_frame_time = now;
+
   *(volatile Uint32 *)EDMA3_0_CC_ICR = EDMA_CONFIG_INTERRUPT_MASK; // clear interrupt
   if(++ready_index >= NUM_BUFFERS) // update buffer index
     ready_index = 0;
-  if(buffer_ready == 1) // set a flag if buffer isn't processed in time
-    over_run = 1;
+  deadline_isr(&frame_deadline, now, buffer_ready); // count a buffer not processed in time
+  FRAME_INVALIDATE(buffer[ready_index]); // drop stale cached copies
   buffer_ready = 1; // mark buffer as ready for processing
 }
 
+PLACE_INIT_CODE(bench_frames)
+static void bench_frames(COMPLEX *twiddle_factors, cycle_stats_t *stats)
+{
+  static const cycle_stats_t cleared = { 0 };
+  uint32_t seed = 1;
+  Int16 *p;
+  int i, j;
+
+  frame_cycles = cleared;
+  for(i = 0; i < CACHE_BENCH_FRAMES; i++) {
+    // Noise keeps every stage of the decoder busy
+    p = buffer[ready_index];
+    for(j = 0; j < BUFFER_LENGTH; j++) {
+      seed = seed * 1664525 + 1013904223;
+      p[j] = (Int16)((seed >> 16) & 0x3FFF) - 0x2000;
+    }
+    ProcessBuffer(twiddle_factors);
+  }
+  *stats = frame_cycles;
+  frame_cycles = cleared;
+  render_cycles = cleared;
+}
+
+PLACE_INIT_CODE(BenchmarkCaches)
+void BenchmarkCaches(COMPLEX *twiddle_factors)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Times ProcessBuffer over CACHE_BENCH_FRAMES frames of
+//            noise with the caches off, then on
+//
+// Input:     twiddle_factors - FFT_LENGTH twiddle factors
+//
+// Returns:   Nothing
+//
+// Calls:     Disable_Cache, Init_Cache, ProcessBuffer, ZeroBuffers,
+//            InitDecoder
+//
+// Notes:     Results go to cache_off_cycles and cache_on_cycles. Call
+//            before the EDMA and UART are started: telemetry queued
+//            meanwhile is dropped when Init_UART2 clears the ring. The
+//            frames and the decoder are reset afterwards.
+///////////////////////////////////////////////////////////////////////
+{
+  Disable_Cache();
+  bench_frames(twiddle_factors, &cache_off_cycles);
+  Init_Cache();
+  bench_frames(twiddle_factors, &cache_on_cycles);
+
+  ZeroBuffers();
+  InitDecoder();
+}
+
+void SetEncoderRate(float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Recomputes the tone step sizes for a new sample rate
+//
+// Input:     sample_rate - new sample rate in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     The running indices are kept, so the tones continue with
+//            the same phase and there is no click at the change
+///////////////////////////////////////////////////////////////////////
+{
+  Uint8 i;
+
+  for(i = 0;i < NUM_OUTPUT_FREQS;i++)
+    waveform_step_sizes[i] = output_frequencies[i] * MAX_WAVEFORM_INDEX / sample_rate;
+
+#ifdef LOOPBACK
+  tones_set_rate(sample_rate);
+#endif
+}
+
+PLACE_RT_CODE(Codec_ISR)
 interrupt void Codec_ISR()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Codec interface interrupt service routine
@@ -363,7 +513,6 @@ interrupt void Codec_ISR()
   /* add any local variables here */
   float output_signal = 0.0;
   uint8_t i=0;
-  float waveform_step_size;
 
   if(CheckForOverrun())	// overrun error occurred (i.e. halted DSP)
     return;             // so serial port is reset to recover
@@ -371,14 +520,11 @@ interrupt void Codec_ISR()
   CodecDataIn.UINT = ReadCodecData(); // THIS LINE IS CRUCIAL. WILL NOT RUN WITHOUT.
 
   for(i=0; i<NUM_OUTPUT_FREQS; i++) {
-    // Calculate the appropriate step size
-    waveform_step_size = output_frequencies[i] / SAMPLED_LUT_FREQUENCY;
-
     // Add the current freq signal to the total output signal
     output_signal += sine_wave(running_waveform_indices[i]);
 
     // Increment by step size
-    running_waveform_indices[i] += waveform_step_size;
+    running_waveform_indices[i] += waveform_step_sizes[i];
 
     // Wrap around if index goes too high
     if(running_waveform_indices[i] >= MAX_WAVEFORM_INDEX) {
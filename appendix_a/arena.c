@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////////
+// Filename: arena.c
+//
+// Synopsis: Bump allocator for decoder buffers. The board hands
+//   it a static block of hot memory; host tools hand it whatever
+//   they like, so no part of the decoder calls malloc.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+#include "placement.h"
+
+PLACE_INIT_CODE(init_arena)
+void init_arena(arena_t *arena, void *memory, size_t size)
+{
+  arena->base = memory;
+  arena->size = size;
+  arena->used = 0;
+}
+
+PLACE_INIT_CODE(arena_alloc)
+void *arena_alloc(arena_t *arena, size_t size)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Takes the next ARENA_ALIGN-aligned block from an arena
+//
+// Input:     arena - arena to allocate from
+//            size - bytes wanted
+//
+// Returns:   The block, or NULL if the arena is too small
+//
+// Calls:     Nothing
+//
+// Notes:     The block is not cleared
+///////////////////////////////////////////////////////////////////////
+{
+  uintptr_t start = (uintptr_t)(arena->base + arena->used);
+  size_t pad = (ARENA_ALIGN - start % ARENA_ALIGN) % ARENA_ALIGN;
+
+  if(pad + size > arena->size - arena->used)
+    return NULL;
+
+  arena->used += pad + size;
+  return (void *)(start + pad);
+}
@@ -0,0 +1,23 @@
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Bump allocator over memory the caller owns. Nothing is freed
+// piecemeal; the caller resets or discards the whole arena.
+typedef struct {
+  uint8_t *base;
+  size_t size;
+  size_t used;
+} arena_t;
+
+#define ARENA_ALIGN 8		// double word, as LDDW and the EDMA like it
+
+// Bytes an arena needs for an object of the given size, worst case
+#define ARENA_BYTES(size)	((((size) + ARENA_ALIGN - 1) / ARENA_ALIGN) * ARENA_ALIGN + ARENA_ALIGN)
+
+void init_arena(arena_t *arena, void *memory, size_t size);
+void *arena_alloc(arena_t *arena, size_t size);
+
+#endif
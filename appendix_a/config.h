@@ -9,28 +9,176 @@
 #define APPENDIX_A_CONFIG_H_
 
 
+// Host tools pick the build on the command line (-DDECODER)
+#if !defined(DECODER) && !defined(ENCODER)
 // #define DECODER
 #define ENCODER
+#endif
+
+// Defining both gives the loopback build: one EDMA frame clock drives the
+// DTFM tone renderer on the transmit path and the decoder on the receive
+// path, at the decoder's rate
+#if defined(ENCODER) && defined(DECODER)
+#define LOOPBACK
+#endif
+
 
+// Decoder builds can run the codec DECIMATION times faster than the
+// decoder and filter the capture down in front of it (decimator.h). The
+// anti-alias taps are generated for one factor by host/decimator_design;
+// 1 feeds the EDMA frames to the decoder as they are.
+#ifndef DECIMATION
+#define DECIMATION 1
+#endif
 
-#ifdef DECODER
+// Sample rate the decoder (SAMPLING_FREQUENCY) and the codec
+// (CODEC_FREQUENCY) start at. The rate can be changed at runtime (see
+// rate.h); everything below that depends on it is recomputed then.
+#if defined(DECODER)
 #define SAMPLING_FREQUENCY 8000
-#define SAMPLED_LUT_FREQUENCY 1
-#define NUM_SAMPLES ((SAMPLING_FREQUENCY / SAMPLED_LUT_FREQUENCY) / 2)
-#define MAX_WAVEFORM_INDEX ((NUM_SAMPLES) * 2)
-#define NUM_OUTPUT_FREQS 2
+#define CODEC_FREQUENCY (SAMPLING_FREQUENCY * DECIMATION)
 #define NUM_DETECTED_PEAKS 1
+#elif defined(ENCODER)
+#define SAMPLING_FREQUENCY 48000
+#define CODEC_FREQUENCY SAMPLING_FREQUENCY
 #endif
 
-#ifdef ENCODER
-#define SAMPLING_FREQUENCY 48000
+// C674x core clock; TSCL counts at this rate, so frame deadlines in
+// cycles are CPU_CLOCK_HZ * BUFFER_COUNT / rate
+#define CPU_CLOCK_HZ 300000000
+
+// Highest rate the decoder accepts: FFT bins widen with the rate, and
+// above 16 kHz 697/770 Hz fall inside the same bin at FFT_LENGTH 256
+#define DECODER_MAX_SAMPLING_FREQUENCY 16000
+
+// The waveform tables hold half a cycle of a SAMPLED_LUT_FREQUENCY wave
+// sampled at 48 kHz, whatever rate the codec runs at
 #define SAMPLED_LUT_FREQUENCY 10
-#define NUM_SAMPLES ((SAMPLING_FREQUENCY / SAMPLED_LUT_FREQUENCY) / 2)
+#define NUM_SAMPLES ((48000 / SAMPLED_LUT_FREQUENCY) / 2)
 #define MAX_WAVEFORM_INDEX ((NUM_SAMPLES) * 2)
 #define NUM_OUTPUT_FREQS 2
+
+// FFT length (power of two). Peaks are interpolated between bins, so
+// 256 (32 ms at 8 kHz) resolves every DTFM tone. 128 works on clean
+// lines, but 697/770 Hz are then only 1.2 bins apart.
+#ifndef FFT_LENGTH
+#define FFT_LENGTH 256
+#endif
+
+// Samples between analyses of the last FFT_LENGTH samples (<= FFT_LENGTH).
+// Independent of the EDMA frame length (BUFFER_COUNT in frames.h).
+#ifndef ANALYSIS_HOP
+#define ANALYSIS_HOP 64
+#endif
+#define NUM_FFT_SAMPLES ((float)FFT_LENGTH)
+
+// Analysis window of the STFT detector (window.h):
+//   WINDOW_HANN            - narrowest main lobe, sidelobes 31 dB down
+//   WINDOW_BLACKMAN_HARRIS - sidelobes 92 dB down, main lobe twice as wide
+//   WINDOW_FLAT_TOP        - tone levels true between bins, widest lobe;
+//                            needs FFT_LENGTH 512 at 8 kHz
+#define WINDOW_HANN 0
+#define WINDOW_BLACKMAN_HARRIS 1
+#define WINDOW_FLAT_TOP 2
+#ifndef ANALYSIS_WINDOW
+#define ANALYSIS_WINDOW WINDOW_HANN
+#endif
+
+// Detector engine used by ProcessBuffer:
+//   DETECTOR_STFT - windowed FFT of the last FFT_LENGTH samples every hop
+//   DETECTOR_SDFT - sliding DFT on the eight DTFM bins, updated per sample
+#define DETECTOR_STFT 0
+#define DETECTOR_SDFT 1
+#ifndef DETECTOR
+#define DETECTOR DETECTOR_STFT
+#endif
+
+// Energy gate in front of the FFT (gate.h, STFT detector): a hop whose
+// window is less than GATE_OPEN_DB above the adaptive noise floor, below
+// GATE_MIN_LEVEL rms (ADC counts), or crosses zero less often than the
+// lowest DTFM tone skips the FFT and reports no digit on that channel
+#ifndef GATE_ENABLE
+#define GATE_ENABLE 1
+#endif
+#define GATE_OPEN_DB 1.5f
+#define GATE_MIN_LEVEL 20.0f
+
+// Validity checks on the two tones the peak stage picks (peaks.c, STFT
+// detector), in the spirit of ITU-T Q.24. Limits are power ratios.
+#define DTFM_NORMAL_TWIST 7.94f		// row tone 8 dB over the column tone, +1 dB slack
+#define DTFM_REVERSE_TWIST 3.16f	// column tone 4 dB over the row tone, +1 dB slack
+#define DTFM_RELATIVE_PEAK 4.0f	// other tones of a group 6 dB under its tone
+#define DTFM_HARMONIC 4.0f		// second harmonics 6 dB under their tones
+#define DTFM_MIN_SHARE 0.5f		// the tones hold half the band's energy
+
+// Memory the decoder's working set is linked into (see placement.h):
+//   PLACEMENT_INTERNAL - DSPRAM (L2 SRAM); only cold tables go to SDRAM
+//   PLACEMENT_SDRAM    - external mDDR2, as the lab originally had it
+#define PLACEMENT_INTERNAL 0
+#define PLACEMENT_SDRAM 1
+#ifndef MEMORY_PLACEMENT
+#define MEMORY_PLACEMENT PLACEMENT_INTERNAL
+#endif
+
+// Caches set up by Init_Cache at boot. L1P and L1D are all cache.
+// CACHE_L2_KB of the 256 KB L2 is cache too (0, 32, 64, 128 or 256);
+// it comes off the top of DSPRAM, so link6748.cmd must match. With
+// CACHE_SDRAM the external memory may be cached as well.
+#define CACHE_L2_KB 32
+#define CACHE_SDRAM 1
+
+// EDMA frames ProcessBuffer is timed over at boot, with the caches off
+// and then on; the averages are sent with the stats telemetry
+#define CACHE_BENCH_FRAMES 32
+
+// Synthetic load added to every frame to measure the headroom left
+// (load_inject.h):
+//   LOAD_OFF   - none
+//   LOAD_FIXED - LOAD_CYCLES busy cycles per frame, plus LOAD_JITTER
+//   LOAD_SWEEP - from zero up in steps of 1/LOAD_SWEEP_STEPS of the frame
+//                period, LOAD_SWEEP_FRAMES frames each, until the first
+//                over_run; the last clean step is sent with the stats
+#define LOAD_OFF 0
+#define LOAD_FIXED 1
+#define LOAD_SWEEP 2
+#ifndef LOAD_INJECT
+#define LOAD_INJECT LOAD_OFF
+#endif
+#define LOAD_CYCLES 0
+#define LOAD_JITTER LOAD_JITTER_NONE	// or LOAD_JITTER_UNIFORM / _EXPONENTIAL
+#define LOAD_JITTER_CYCLES 0		// jitter bound or mean, in cycles
+#define LOAD_SWEEP_STEPS 100
+#define LOAD_SWEEP_FRAMES 64
+
+// Digit segmentation timing: a reading must hold DIGIT_MIN_ON_MS to
+// start a digit, and a different reading DIGIT_MIN_OFF_MS to end it
+#define DIGIT_MIN_ON_MS 40
+#define DIGIT_MIN_OFF_MS 40
+
+// Serial output of the decoder on UART2. With TELEMETRY_BINARY, digits,
+// peak lists, spectra and counters are sent as binary frames (telemetry.h);
+// otherwise only digits are sent, one text line each.
+#define TELEMETRY_BINARY
+#define TELEMETRY_BAUD_RATE 115200
+#define TELEMETRY_PEAKS_EVERY 2		// analysis hops per peak list
+#define TELEMETRY_SPECTRUM_EVERY 16	// analysis hops per spectrum
+#define TELEMETRY_STATS_EVERY 32	// EDMA frames per counter report
+
+// Decode the left and right inputs as two independent lines.
+// Both channels share one complex FFT (L in .re, R in .im).
+// #define DUAL_CHANNEL
+
+#ifdef DUAL_CHANNEL
+#define NUM_DECODE_CHANNELS 2
+#else
+#define NUM_DECODE_CHANNELS 1
 #endif
 
-#define NUM_FFT_SAMPLES 1024.0
+// Loopback build: digits dialled on the transmit path, repeated forever
+#define LOOPBACK_PATTERN "123A456B789C*0#D"
+#define TONE_ON_MS 60
+#define TONE_OFF_MS 60
+#define TONE_AMPLITUDE 8000	// peak of each tone in ADC counts
 
 typedef enum wave_type
 {
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////
+// Filename: cpu_load.c
+//
+// Synopsis: CPU utilisation from the time spent waiting for
+//   frames. The frame loop reports each wait with cpu_load_idle
+//   and each new frame with cpu_load_frame; whatever is not idle
+//   between two frames was busy, ISRs included.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "cpu_load.h"
+#include "placement.h"
+
+PLACE_INIT_CODE(init_cpu_load)
+void init_cpu_load(cpu_load_t *load, uint32_t now)
+{
+  load->frame_start = now;
+  load->idle = 0;
+  load->last_idle = 0;
+  load->last_busy = 0;
+  load->load_percent = 0;
+  load->peak_percent = 0;
+  load->total_idle = 0;
+  load->total_busy = 0;
+  load->frames = 0;
+}
+
+PLACE_RT_CODE(cpu_load_idle)
+void cpu_load_idle(cpu_load_t *load, uint32_t ticks)
+{
+  load->idle += ticks;
+}
+
+PLACE_RT_CODE(cpu_load_frame)
+void cpu_load_frame(cpu_load_t *load, uint32_t now)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Closes the current frame and starts the next
+//
+// Input:     load - accounting to update
+//            now - tick the new frame starts at
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Call once per frame, when the loop wakes up for it
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t period = now - load->frame_start;
+  uint32_t idle = load->idle < period ? load->idle : period;
+
+  load->last_idle = idle;
+  load->last_busy = period - idle;
+  load->load_percent = period ? (uint8_t)((uint64_t)load->last_busy * 100 / period) : 0;
+  if(load->load_percent > load->peak_percent)
+    load->peak_percent = load->load_percent;
+  load->total_idle += idle;
+  load->total_busy += load->last_busy;
+  load->frames++;
+
+  load->frame_start = now;
+  load->idle = 0;
+}
+
+uint16_t cpu_load_average(const cpu_load_t *load)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Busy share since reset
+//
+// Input:     load - accounting to read
+//
+// Returns:   Busy time per mille
+//
+// Calls:     Nothing
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  uint64_t total = load->total_idle + load->total_busy;
+
+  return total ? (uint16_t)(load->total_busy * 1000 / total) : 0;
+}
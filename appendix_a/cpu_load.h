@@ -0,0 +1,26 @@
+#ifndef CPU_LOAD_H_INCLUDED
+#define CPU_LOAD_H_INCLUDED
+
+#include <stdint.h>
+
+// Busy/idle accounting per EDMA frame. Ticks are CPU cycles (TSCL) on
+// the board and nanoseconds in the host simulation; only differences
+// are used, so the 32-bit counters may wrap.
+typedef struct {
+  uint32_t frame_start;		// tick the current frame began at
+  uint32_t idle;		// idle ticks so far in the current frame
+  uint32_t last_idle;		// idle ticks of the last complete frame
+  uint32_t last_busy;		// busy ticks of the last complete frame
+  uint8_t load_percent;		// busy share of the last complete frame
+  uint8_t peak_percent;		// highest load_percent since reset
+  uint64_t total_idle;
+  uint64_t total_busy;
+  uint32_t frames;
+} cpu_load_t;
+
+void init_cpu_load(cpu_load_t *load, uint32_t now);
+void cpu_load_idle(cpu_load_t *load, uint32_t ticks);
+void cpu_load_frame(cpu_load_t *load, uint32_t now);
+uint16_t cpu_load_average(const cpu_load_t *load);
+
+#endif
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////
+// Filename: deadline.c
+//
+// Synopsis: Deadline monitor for the EDMA frame loop. The ISR
+//   stamps each frame's release, the frame loop stamps the start,
+//   zone boundaries and end of processing, and each frame's
+//   headroom against the frame period goes into a histogram, the
+//   late and over_run counters, and a trace of the slowest frame.
+//   Every call is a handful of integer operations.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "deadline.h"
+#include "placement.h"
+
+PLACE_INIT_CODE(init_deadline)
+void init_deadline(deadline_t *dl, uint32_t period)
+{
+  dl->isr_time = 0;
+  dl->over_runs = 0;
+  dl->release = 0;
+  dl->mark = 0;
+  dl->frames = 0;
+  dl->late = 0;
+  dl->run = 0;
+  dl->longest_run = 0;
+  deadline_set_period(dl, period);
+}
+
+void deadline_set_period(deadline_t *dl, uint32_t period)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sets the frame period deadlines are measured against
+//
+// Input:     dl - monitor to update
+//            period - ticks between EDMA frames
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     The histogram, minimum headroom and worst-frame trace are
+//            relative to the period and start again; the counters
+//            carry on
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  dl->period = period;
+  dl->bin_width = period / DEADLINE_BINS ? period / DEADLINE_BINS : 1;
+  dl->min_headroom = (int32_t)period;
+  for(i = 0; i < DEADLINE_BINS; i++)
+    dl->histogram[i] = 0;
+  for(i = 0; i < DEADLINE_ZONES; i++)
+    dl->current.zone[i] = dl->worst.zone[i] = 0;
+  dl->worst.frame = 0;
+  dl->worst.duration = 0;
+}
+
+PLACE_RT_CODE(deadline_isr)
+void deadline_isr(deadline_t *dl, uint32_t now, int missed)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Records the release of a frame
+//
+// Input:     dl - monitor to update
+//            now - tick of the EDMA interrupt
+//            missed - non-zero if the previous frame was still waiting
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Call from EDMA_ISR
+///////////////////////////////////////////////////////////////////////
+{
+  dl->isr_time = now;
+  if(missed)
+    dl->over_runs++;
+}
+
+PLACE_RT_CODE(deadline_start)
+void deadline_start(deadline_t *dl, uint32_t now)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Marks the start of processing of the last released frame
+//
+// Input:     dl - monitor to update
+//            now - current tick
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     The release is latched here, so an interrupt for the next
+//            frame during processing does not move this one's deadline
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  dl->release = dl->isr_time;
+  dl->mark = now;
+  dl->current.frame = dl->frames;
+  dl->current.zone[DEADLINE_ZONE_WAKE] = now - dl->release;
+  for(i = DEADLINE_ZONE_WAKE + 1; i < DEADLINE_ZONES; i++)
+    dl->current.zone[i] = 0;
+}
+
+PLACE_RT_CODE(deadline_zone)
+void deadline_zone(deadline_t *dl, int zone, uint32_t now)
+{
+  dl->current.zone[zone] = now - dl->mark;
+  dl->mark = now;
+}
+
+PLACE_RT_CODE(deadline_end)
+void deadline_end(deadline_t *dl, uint32_t now)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Closes the frame and scores it against its deadline
+//
+// Input:     dl - monitor to update
+//            now - current tick
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Headroom is the period minus the time from release to
+//            now. On-time frames go into the histogram; late ones are
+//            counted, with the longest run of them.
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t duration = now - dl->release;
+  int32_t headroom = (int32_t)(dl->period - duration);
+  uint32_t bin;
+
+  dl->current.duration = duration;
+  dl->frames++;
+
+  if(headroom < dl->min_headroom)
+    dl->min_headroom = headroom;
+
+  if(headroom < 0) {
+    dl->late++;
+    if(++dl->run > dl->longest_run)
+      dl->longest_run = dl->run;
+  }
+  else {
+    dl->run = 0;
+    bin = (uint32_t)headroom / dl->bin_width;
+    dl->histogram[bin < DEADLINE_BINS ? bin : DEADLINE_BINS - 1]++;
+  }
+
+  if(duration > dl->worst.duration)
+    dl->worst = dl->current;
+}
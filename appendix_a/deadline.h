@@ -0,0 +1,53 @@
+#ifndef DEADLINE_H_INCLUDED
+#define DEADLINE_H_INCLUDED
+
+#include <stdint.h>
+
+// Parts of a frame timed separately. The wake zone runs from the EDMA
+// interrupt to the start of processing, the others are set by the
+// frame loop with deadline_zone.
+#define DEADLINE_ZONE_WAKE	0	// EDMA_ISR to ProcessBuffer
+#define DEADLINE_ZONE_DECODE	1	// DecodeFrame, telemetry included
+#define DEADLINE_ZONE_RENDER	2	// tone rendering (loopback build)
+#define DEADLINE_ZONE_LOAD	3	// synthetic load (LOAD_INJECT builds)
+#define DEADLINE_ZONES		4
+
+// Headroom histogram: bin i counts frames that finished with between
+// i and i+1 sixteenths of the frame period to spare
+#define DEADLINE_BINS		16
+
+// Timing of one frame
+typedef struct {
+  uint32_t frame;		// frame number, from 0 at reset
+  uint32_t duration;		// EDMA_ISR to the end of processing
+  uint32_t zone[DEADLINE_ZONES];
+} deadline_trace_t;
+
+// Per-frame deadline accounting. A frame is released by its EDMA
+// interrupt and is due at the next one, a frame period later. Ticks are
+// CPU cycles (TSCL) on the board and nanoseconds in the host simulation.
+typedef struct {
+  uint32_t period;		// ticks between frames at the current rate
+  uint32_t bin_width;		// period / DEADLINE_BINS
+  volatile uint32_t isr_time;	// tick of the last EDMA interrupt
+  volatile uint32_t over_runs;	// frames still unprocessed at the next interrupt
+  uint32_t release;		// isr_time of the frame being processed
+  uint32_t mark;		// end of its last zone
+  uint32_t frames;		// frames processed
+  uint32_t late;		// frames that finished after their deadline
+  uint32_t run;			// late frames in a row, up to the last one
+  uint32_t longest_run;
+  int32_t min_headroom;		// least time to spare, negative when late
+  uint32_t histogram[DEADLINE_BINS];	// frames on time, by headroom
+  deadline_trace_t current;
+  deadline_trace_t worst;	// slowest frame at the current rate
+} deadline_t;
+
+void init_deadline(deadline_t *dl, uint32_t period);
+void deadline_set_period(deadline_t *dl, uint32_t period);
+void deadline_isr(deadline_t *dl, uint32_t now, int missed);
+void deadline_start(deadline_t *dl, uint32_t now);
+void deadline_zone(deadline_t *dl, int zone, uint32_t now);
+void deadline_end(deadline_t *dl, uint32_t now);
+
+#endif
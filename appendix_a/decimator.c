@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////
+// Filename: decimator.c
+//
+// Synopsis: Polyphase FIR decimator that lets the codec run at
+//   48 kHz while the decoder works at 8 kHz. It reads the
+//   interleaved L/R samples straight out of the EDMA frame and
+//   writes decimated pairs in the same layout, so the decoder
+//   takes them as they are. The anti-alias filter is designed
+//   by host/decimator_design into decimator_taps.h. Only the
+//   outputs that are kept get computed, one per DECIMATION
+//   inputs, at DECIMATOR_PHASE_TAPS multiply-adds per phase.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "config.h"
+#include "decimator.h"
+#include "decimator_taps.h"
+#include "placement.h"
+
+#if DECIMATION > 1 && (DECIMATION != DECIMATOR_TAPS_FACTOR || DECIMATOR_PHASE_TAPS != DECIMATOR_TAPS_PER_PHASE)
+#error decimator_taps.h was designed for another decimator, rerun host/decimator_design
+#endif
+
+PLACE_INIT_CODE(init_decimator)
+void init_decimator(decimator_t *dec)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Clears a decimator's history
+//
+// Input:     dec - decimator to initialize
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Also used after a rate change, as the history holds
+//            samples taken at the old rate
+///////////////////////////////////////////////////////////////////////
+{
+  int c, p, i;
+
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++)
+    for(p = 0; p < DECIMATION; p++)
+      for(i = 0; i < 2 * DECIMATOR_PHASE_TAPS; i++)
+	dec->delay[c][p][i] = 0.0f;
+  dec->index = 0;
+  dec->phase = 0;
+}
+
+PLACE_RT_CODE(decimator_process)
+int decimator_process(decimator_t *dec, const int16_t *pBuf, int num_samples, int16_t *out)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Filters and decimates a block of interleaved samples
+//
+// Input:     dec - decimator the stream belongs to
+//            pBuf - interleaved samples, left first
+//            num_samples - number of L/R sample pairs
+//            out - room for num_samples / DECIMATION + 1 pairs
+//
+// Returns:   Number of pairs written to out
+//
+// Calls:     Nothing
+//
+// Notes:     Blocks need not be a multiple of DECIMATION; the
+//            phase carries over to the next call. Only the decoded
+//            channels are written (left, and right with
+//            DUAL_CHANNEL).
+///////////////////////////////////////////////////////////////////////
+{
+  int i, c, p, j, n = 0;
+  uint16_t k = dec->index;
+  uint8_t phase = dec->phase;
+  const float *taps, *x;
+  float acc, s;
+
+  for(i = 0; i < num_samples; i++) {
+    // Commutator: the sample joins the line of its phase
+    for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+      s = pBuf[2*i + c];
+      dec->delay[c][phase][k] = s;
+      dec->delay[c][phase][k + DECIMATOR_PHASE_TAPS] = s;
+    }
+    if(++phase < DECIMATION)
+      continue;
+    phase = 0;
+    if(++k >= DECIMATOR_PHASE_TAPS)
+      k = 0;
+
+    // One output from every phase; the oldest sample is now at k
+    for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+      acc = 0.0f;
+      for(p = 0; p < DECIMATION; p++) {
+	taps = decimator_taps[p];
+	x = &dec->delay[c][p][k];
+	for(j = 0; j < DECIMATOR_PHASE_TAPS; j++)
+	  acc += taps[j] * x[j];
+      }
+      if(acc > 32767.0f)
+	acc = 32767.0f;
+      if(acc < -32768.0f)
+	acc = -32768.0f;
+      out[2*n + c] = (int16_t)acc;
+    }
+    n++;
+  }
+
+  dec->index = k;
+  dec->phase = phase;
+  return n;
+}
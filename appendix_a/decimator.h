@@ -0,0 +1,26 @@
+#ifndef DECIMATOR_H_INCLUDED
+#define DECIMATOR_H_INCLUDED
+
+#include <stdint.h>
+#include "config.h"
+
+// Taps per phase of the anti-alias filter; decimator_taps.h must have
+// been generated with the same number (host/decimator_design -t)
+#define DECIMATOR_PHASE_TAPS	16
+
+// Polyphase FIR decimator by DECIMATION for the decoded channels.
+// Each input sample goes into the delay line of its phase (the
+// commutator); once every phase has had one, a single output is the sum
+// of every phase line against its row of decimator_taps. Each line is
+// circular and written twice, at index and index + DECIMATOR_PHASE_TAPS,
+// so the taps always read a straight run of it.
+typedef struct {
+  float delay[NUM_DECODE_CHANNELS][DECIMATION][2 * DECIMATOR_PHASE_TAPS];
+  uint16_t index;		// slot the current output period writes
+  uint8_t phase;		// phase of the next input sample
+} decimator_t;
+
+void init_decimator(decimator_t *dec);
+int decimator_process(decimator_t *dec, const int16_t *pBuf, int num_samples, int16_t *out);
+
+#endif
@@ -0,0 +1,50 @@
+/*
+ * decimator_taps.h
+ *
+ * Generated by host/decimator_design -M 6 -t 16 -r 48000 -p 1800 -s 4000 -a 70
+ * Do not edit; rerun the generator (see README.md).
+ *
+ * Kaiser-windowed sinc, 96 taps, cut off at 2900 Hz of 48000 Hz, unity
+ * gain at DC. Passband within 0.004 dB to 1800 Hz, stopband -68.5 dB from
+ * 4000 Hz. Row p holds the taps for the input samples that arrive in
+ * phase p of each output period, oldest first. Included by
+ * decimator.c only.
+ */
+
+#ifndef APPENDIX_A_DECIMATOR_TAPS_H_
+#define APPENDIX_A_DECIMATOR_TAPS_H_
+
+#include "placement.h"
+
+#define DECIMATOR_TAPS_FACTOR 6
+#define DECIMATOR_TAPS_PER_PHASE 16
+
+PLACE_HOT(decimator_taps)
+const float decimator_taps[DECIMATOR_TAPS_FACTOR][DECIMATOR_TAPS_PER_PHASE] = {
+  { -3.63688888e-05f, -1.6123257e-05f, 0.000910557698f, -0.00278785356f,
+   0.00290637649f, 0.00413830604f, -0.0216274667f, 0.0482383927f,
+   0.120053357f, 0.0288249753f, -0.0204359483f, 0.0071009091f,
+   0.00066380624f, -0.00207160693f, 0.000932309414f, -0.000113725876f },
+  { -7.27517638e-05f, 0.000144851551f, 0.000688185654f, -0.00320133325f,
+   0.00522040952f, -0.000257178437f, -0.0194237992f, 0.0681236977f,
+   0.114040031f, 0.0113926264f, -0.0167119879f, 0.00849674137f,
+   -0.00119852736f, -0.0012306141f, 0.000805816281f, -0.000152264496f },
+  { -0.000113719739f, 0.00035817035f, 0.000239191302f, -0.00314321942f,
+   0.00720820124f, -0.00567937799f, -0.0132389939f, 0.0867984472f,
+   0.102592454f, -0.00287769433f, -0.0114584767f, 0.00843470551f,
+   -0.00248984336f, -0.000421878941f, 0.000594323618f, -0.000146088089f },
+  { -0.000146088089f, 0.000594323618f, -0.000421878941f, -0.00248984336f,
+   0.00843470551f, -0.0114584767f, -0.00287769433f, 0.102592454f,
+   0.0867984472f, -0.0132389939f, -0.00567937799f, 0.00720820124f,
+   -0.00314321942f, 0.000239191302f, 0.00035817035f, -0.000113719739f },
+  { -0.000152264496f, 0.000805816281f, -0.0012306141f, -0.00119852736f,
+   0.00849674137f, -0.0167119879f, 0.0113926264f, 0.114040031f,
+   0.0681236977f, -0.0194237992f, -0.000257178437f, 0.00522040952f,
+   -0.00320133325f, 0.000688185654f, 0.000144851551f, -7.27517638e-05f },
+  { -0.000113725876f, 0.000932309414f, -0.00207160693f, 0.00066380624f,
+   0.0071009091f, -0.0204359483f, 0.0288249753f, 0.120053357f,
+   0.0482383927f, -0.0216274667f, 0.00413830604f, 0.00290637649f,
+   -0.00278785356f, 0.000910557698f, -1.6123257e-05f, -3.63688888e-05f }
+};
+
+#endif /* APPENDIX_A_DECIMATOR_TAPS_H_ */
@@ -0,0 +1,349 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: decoder.c
+//
+// Synopsis: DTFM decoder core. Runs the selected detector over
+//           interleaved L/R samples and segments its readings into
+//           digit events. Touches no peripherals, so the same code
+//           runs under ProcessBuffer on the board and in the host
+//           tools; telemetry calls are made on the board only.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "config.h"
+#include "fft.h"
+#include "stft.h"
+#include "sdft.h"
+#include "segmenter.h"
+#include "events.h"
+#include "profile.h"
+#include "arena.h"
+#include "decoder.h"
+#include "decimator.h"
+#include "placement.h"
+#ifdef _TMS320C6X
+#include "report.h"
+#endif
+
+decoder_t board_decoder;
+
+PLACE_HOT(board_arena_memory)
+#ifdef _TMS320C6X
+#pragma DATA_ALIGN (board_arena_memory, ARENA_ALIGN);
+#endif
+static uint8_t board_arena_memory[DECODER_ARENA_BYTES];
+
+#if DECIMATION > 1
+// Decimated pairs handed to the decoder at a time
+#define DECIMATED_PAIRS 64
+
+// Filter history of the capture, and the block it is decimated into
+PLACE_HOT(board_decimator)
+static decimator_t board_decimator;
+PLACE_HOT(decimated)
+static int16_t decimated[2*(DECIMATED_PAIRS + 1)];
+#endif
+
+PLACE_INIT_CODE(init_decoder)
+int init_decoder(decoder_t *dec, arena_t *arena, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sets up a decoder instance
+//
+// Input:     dec - instance to initialize
+//            arena - at least DECODER_ARENA_BYTES free, for the
+//                    detector's buffers
+//            sample_rate - sample rate of the stream in Hz
+//
+// Returns:   0 on success, -1 if the arena ran out
+//
+// Calls:     stft_alloc or sdft_alloc, decoder_reset
+//
+// Notes:     The arena must outlive the decoder
+///////////////////////////////////////////////////////////////////////
+{
+#if DETECTOR == DETECTOR_SDFT
+  if(sdft_alloc(&dec->sdft, arena) < 0)
+    return -1;
+#else
+  if(stft_alloc(&dec->stft, arena) < 0)
+    return -1;
+#endif
+
+  decoder_reset(dec, sample_rate);
+  return 0;
+}
+
+void decoder_reset(decoder_t *dec, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Prepares an initialized decoder for a new stream
+//
+// Input:     dec - instance to reset
+//            sample_rate - sample rate of the stream in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     init_event_ring, decoder_set_rate
+//
+// Notes:     Any queued events are discarded
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  for(i = 0;i < NUM_DECODE_CHANNELS;i++) {
+    dec->detected_char[i] = '\0';
+    dec->segmenters[i].active = '\0';
+  }
+
+  dec->sample_clock = 0;
+  dec->hop_cycles.last = 0;
+  dec->hop_cycles.max = 0;
+  dec->hop_cycles.total = 0;
+  dec->hop_cycles.count = 0;
+#if DETECTOR == DETECTOR_STFT
+  dec->stft.hops = 0;
+  dec->stft.hops_gated = 0;
+#endif
+  init_event_ring(&dec->events);
+
+  decoder_set_rate(dec, sample_rate);
+}
+
+void decoder_set_rate(decoder_t *dec, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Recomputes every rate-dependent part of the decoder
+//
+// Input:     dec - instance to change
+//            sample_rate - new sample rate in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     segmenter_flush, init_stft or init_sdft, init_segmenter
+//
+// Notes:     Call between frames. Digits in progress are closed at
+//            sample_clock and the detector history is cleared, since
+//            it holds samples taken at the old rate. sample_clock
+//            keeps counting across the change.
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  for(i = 0;i < NUM_DECODE_CHANNELS;i++)
+    segmenter_flush(&dec->segmenters[i], dec->sample_clock);
+
+  for(i = 0;i < NUM_DECODE_CHANNELS;i++) {
+#if DETECTOR == DETECTOR_SDFT
+    init_segmenter(&dec->segmenters[i], &dec->events, i, sample_rate, SDFT_LENGTH);
+#else
+    init_segmenter(&dec->segmenters[i], &dec->events, i, sample_rate, FFT_LENGTH);
+#endif
+  }
+
+#if DETECTOR == DETECTOR_SDFT
+  init_sdft(&dec->sdft, sample_rate);
+#else
+  init_stft(&dec->stft, sample_rate);
+#endif
+}
+
+PLACE_RT_CODE(decoder_process)
+void decoder_process(decoder_t *dec, const int16_t *pBuf, int num_samples, COMPLEX *twiddle_factors)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Decodes one block of interleaved L/R samples
+//
+// Input:     dec - instance the block belongs to
+//            pBuf - interleaved samples, left first
+//            num_samples - number of L/R sample pairs
+//            twiddle_factors - FFT_LENGTH twiddle factors
+//
+// Returns:   Nothing
+//
+// Calls:     stft_write, stft_analyze, sdft_process, segmenter_update,
+//            ReportHop
+//
+// Notes:     detected_char is updated every ANALYSIS_HOP samples,
+//            possibly several times per block. Completed digits are
+//            queued on dec->events. Blocks may be any length; the
+//            board passes whole EDMA frames. The twiddle factors are
+//            only read, so decoders may share them.
+///////////////////////////////////////////////////////////////////////
+{
+  int remaining = num_samples;
+  int n, i;
+  uint32_t start;
+  char *detected = dec->detected_char;
+#if DETECTOR == DETECTOR_SDFT
+  char previous[NUM_DECODE_CHANNELS];
+#else
+  uint32_t stamp;
+#endif
+
+#if DETECTOR == DETECTOR_SDFT
+  // Per-sample tracking, reported to the segmenter once per hop
+  while(remaining > 0) {
+    n = remaining < ANALYSIS_HOP ? remaining : ANALYSIS_HOP;
+
+    for(i = 0;i < NUM_DECODE_CHANNELS;i++)
+      previous[i] = detected[i];
+
+    start = PROFILE_NOW();
+    sdft_process(&dec->sdft, pBuf, n, dec->sample_clock + (num_samples - remaining), detected);
+    PROFILE_RECORD(dec->hop_cycles, start);
+
+    pBuf += 2*n;
+    remaining -= n;
+
+    // Report the change where it happened, then the reading at hop end
+    for(i = 0;i < NUM_DECODE_CHANNELS;i++) {
+      if(detected[i] != previous[i])
+	segmenter_update(&dec->segmenters[i], detected[i], dec->sdft.onset_sample[i]);
+      segmenter_update(&dec->segmenters[i], detected[i], dec->sample_clock + (num_samples - remaining));
+    }
+  }
+#else
+  // Feed the block into the analysis history, one hop at a time
+  while(remaining > 0) {
+    n = stft_write(&dec->stft, pBuf, remaining);
+    pBuf += 2*n;
+    remaining -= n;
+
+    if(stft_hop_ready(&dec->stft)) {
+      start = PROFILE_NOW();
+      stft_analyze(&dec->stft, twiddle_factors, detected);
+      PROFILE_RECORD(dec->hop_cycles, start);
+
+      // Time stamp each reading with the centre of its window, or with
+      // the start of the stream while the window still reaches before it
+      stamp = dec->sample_clock + (num_samples - remaining);
+      if(dec->stft.hops < (FFT_LENGTH/2 + ANALYSIS_HOP - 1) / ANALYSIS_HOP)
+	stamp = 0;
+      else
+	stamp -= FFT_LENGTH/2;
+      for(i = 0;i < NUM_DECODE_CHANNELS;i++)
+	segmenter_update(&dec->segmenters[i], detected[i], stamp);
+
+#ifdef _TMS320C6X
+      ReportHop(&dec->stft, stamp);
+#endif
+    }
+  }
+#endif
+
+  dec->sample_clock += num_samples;
+}
+
+PLACE_INIT_CODE(decoder_destroy)
+void decoder_destroy(decoder_t *dec)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Ends a decoder's stream and detaches its buffers
+//
+// Input:     dec - instance to tear down
+//
+// Returns:   Nothing
+//
+// Calls:     segmenter_flush
+//
+// Notes:     A digit still in progress is queued on dec->events, which
+//            stays readable. The buffers belong to the arena, which
+//            the caller may reuse once every decoder in it is gone.
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  for(i = 0;i < NUM_DECODE_CHANNELS;i++)
+    segmenter_flush(&dec->segmenters[i], dec->sample_clock);
+
+#if DETECTOR == DETECTOR_SDFT
+  dec->sdft.delay_line = NULL;
+#else
+  dec->stft.input = NULL;
+  dec->stft.magnitude = NULL;
+  dec->stft.history = NULL;
+  dec->stft.window = NULL;
+#endif
+}
+
+PLACE_INIT_CODE(InitDecoder)
+void InitDecoder()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Prepares the board's decoder
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     init_arena, init_decoder, init_decimator
+//
+// Notes:     Call before EDMA_Init. The buffers live wherever
+//            MEMORY_PLACEMENT puts hot data (placement.h), the rest
+//            of board_decoder in internal memory.
+///////////////////////////////////////////////////////////////////////
+{
+  arena_t arena;
+
+  init_arena(&arena, board_arena_memory, sizeof(board_arena_memory));
+  init_decoder(&board_decoder, &arena, SAMPLING_FREQUENCY);
+#if DECIMATION > 1
+  init_decimator(&board_decimator);
+#endif
+}
+
+void SetDecoderRate(float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Moves the board's decoder and its telemetry to a new
+//            sample rate
+//
+// Input:     sample_rate - new decoder rate in Hz, after decimation
+//
+// Returns:   Nothing
+//
+// Calls:     decoder_set_rate, init_decimator, ReportSetRate
+//
+// Notes:     Call between frames
+///////////////////////////////////////////////////////////////////////
+{
+  decoder_set_rate(&board_decoder, sample_rate);
+#if DECIMATION > 1
+  init_decimator(&board_decimator);
+#endif
+
+#ifdef _TMS320C6X
+  ReportSetRate(sample_rate);
+#endif
+}
+
+PLACE_RT_CODE(DecodeFrame)
+void DecodeFrame(const int16_t *pBuf, int num_samples, COMPLEX *twiddle_factors)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Decodes one EDMA frame on the board's decoder
+//
+// Input:     pBuf - interleaved samples, left first
+//            num_samples - number of L/R sample pairs
+//            twiddle_factors - FFT_LENGTH twiddle factors
+//
+// Returns:   Nothing
+//
+// Calls:     decimator_process, decoder_process, ReportFrame
+//
+// Notes:     With DECIMATION the frame is filtered straight out of
+//            the EDMA buffer, a block of DECIMATED_PAIRS at a time,
+//            and the decoder reads each block where it was written
+///////////////////////////////////////////////////////////////////////
+{
+#if DECIMATION > 1
+  int n, m;
+
+  while(num_samples > 0) {
+    n = num_samples < DECIMATED_PAIRS * DECIMATION ? num_samples : DECIMATED_PAIRS * DECIMATION;
+    m = decimator_process(&board_decimator, pBuf, n, decimated);
+    decoder_process(&board_decoder, decimated, m, twiddle_factors);
+    pBuf += 2*n;
+    num_samples -= n;
+  }
+#else
+  decoder_process(&board_decoder, pBuf, num_samples, twiddle_factors);
+#endif
+
+#ifdef _TMS320C6X
+  ReportFrame();
+#endif
+}
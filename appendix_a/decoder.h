@@ -0,0 +1,57 @@
+/*
+ * decoder.h
+ *
+ * Hardware-independent DTFM decoder core: detector, segmentation and
+ * the sample clock. Everything a stream needs is held in a decoder_t
+ * and the arena it was given, so host tools can run as many decoders
+ * side by side as they like. The board runs a single instance,
+ * board_decoder, through the InitDecoder / SetDecoderRate /
+ * DecodeFrame wrappers.
+ */
+
+#ifndef APPENDIX_A_DECODER_H_
+#define APPENDIX_A_DECODER_H_
+
+#include <stdint.h>
+#include "config.h"
+#include "fft.h"
+#include "profile.h"
+#include "arena.h"
+#include "events.h"
+#include "segmenter.h"
+#include "stft.h"
+#include "sdft.h"
+
+typedef struct {
+  char detected_char[NUM_DECODE_CHANNELS];
+  uint32_t sample_clock;		// sample number of the next frame's first sample
+  cycle_stats_t hop_cycles;		// cost of one analysis hop
+#if DETECTOR == DETECTOR_SDFT
+  sdft_t sdft;
+#else
+  stft_t stft;
+#endif
+  segmenter_t segmenters[NUM_DECODE_CHANNELS];
+  event_ring_t events;			// completed digits, all channels
+} decoder_t;
+
+// Arena space one decoder needs for its buffers
+#if DETECTOR == DETECTOR_SDFT
+#define DECODER_ARENA_BYTES	SDFT_ARENA_BYTES
+#else
+#define DECODER_ARENA_BYTES	STFT_ARENA_BYTES
+#endif
+
+int init_decoder(decoder_t *dec, arena_t *arena, float sample_rate);
+void decoder_reset(decoder_t *dec, float sample_rate);
+void decoder_set_rate(decoder_t *dec, float sample_rate);
+void decoder_process(decoder_t *dec, const int16_t *pBuf, int num_samples, COMPLEX *twiddle_factors);
+void decoder_destroy(decoder_t *dec);
+
+void InitDecoder();
+void SetDecoderRate(float sample_rate);
+void DecodeFrame(const int16_t *pBuf, int num_samples, COMPLEX *twiddle_factors);
+
+extern decoder_t board_decoder;
+
+#endif /* APPENDIX_A_DECODER_H_ */
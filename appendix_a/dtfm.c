@@ -1,6 +1,11 @@
 #include <stdint.h>
 #include "dtfm.h"
+#include "placement.h"
 
+// Row (low group) tones followed by column (high group) tones
+const float dtfm_tone_freqs[DTFM_NUM_TONES] = { 697.0, 770.0, 852.0, 941.0, 1209.0, 1336.0, 1477.0, 1633.0 };
+
+PLACE_RT_CODE(determine_character)
 char determine_character(float dtfm_freq_one, float dtfm_freq_two) {
 
   char match_values[DTFM_NUM_ROWS][DTFM_NUM_COLS];
@@ -23,21 +28,11 @@ char determine_character(float dtfm_freq_one, float dtfm_freq_two) {
   match_values[3][3] = 'D';
 
   uint16_t boundries[DTFM_NUM_TONES]  = { 730, 810, 900, 1050, 1270, 1400, 1550, 1800 };
-  /* float dtfm_freqs[DTFM_NUM_TONES] = { 697, 770, 852, 941,  1209, 1336, 1477, 1633 }; */
-  float dtfm_freqs[DTFM_NUM_TONES];
+  const float *dtfm_freqs = dtfm_tone_freqs;
   uint16_t dtfm_freq_one_num, dtfm_freq_two_num, dtfm_low_freq, dtfm_high_freq;
   float dtfm_margin;
   uint8_t i;
 
-  dtfm_freqs[0] = 697.0;
-  dtfm_freqs[1] = 770.0;
-  dtfm_freqs[2] = 852.0;
-  dtfm_freqs[3] = 941.0;
-  dtfm_freqs[4] = 1209.0;
-  dtfm_freqs[5] = 1336.0;
-  dtfm_freqs[6] = 1477.0;
-  dtfm_freqs[7] = 1633.0;
-
   // Determine what expected frequencies were
   for(i=0; i<DTFM_NUM_TONES; i++) {
     dtfm_margin =  0.035 * dtfm_freqs[i];
@@ -1,6 +1,12 @@
+#ifndef DTFM_H_INCLUDED
+#define DTFM_H_INCLUDED
 
 #define DTFM_NUM_TONES 8
 #define DTFM_NUM_ROWS  4
 #define DTFM_NUM_COLS  4
 
+extern const float dtfm_tone_freqs[DTFM_NUM_TONES];
+
 char determine_character(float dtfm_freq_one, float dtfm_freq_two);
+
+#endif
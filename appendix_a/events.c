@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////
+// Filename: events.c
+//
+// Synopsis: Fixed-size rings of decoded digit events. Each ring
+//   has one producer (its decoder) and one consumer (whatever
+//   reports digits), so each index is only ever written by one
+//   side and no locking is needed.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "events.h"
+#include "placement.h"
+
+#if (EVENT_RING_SIZE & (EVENT_RING_SIZE - 1)) != 0
+#error EVENT_RING_SIZE must be a power of two
+#endif
+
+void init_event_ring(event_ring_t *events)
+{
+  events->head = 0;
+  events->tail = 0;
+  events->dropped = 0;
+}
+
+PLACE_RT_CODE(event_ring_push)
+int event_ring_push(event_ring_t *events, const digit_event_t *event)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Queues a digit event
+//
+// Input:     events - ring to queue on
+//            event - event to copy into the ring
+//
+// Returns:   1 on success, 0 if the ring was full (event dropped)
+//
+// Calls:     Nothing
+//
+// Notes:     Producer side only
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t h = events->head;
+
+  if(h - events->tail >= EVENT_RING_SIZE) {
+    events->dropped++;
+    return 0;
+  }
+
+  events->ring[h & (EVENT_RING_SIZE - 1)] = *event;
+  events->head = h + 1;		// publish only after the slot is written
+  return 1;
+}
+
+int event_ring_pop(event_ring_t *events, digit_event_t *event)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Takes the oldest digit event out of the ring
+//
+// Input:     events - ring to take from
+//            event - storage for the event
+//
+// Returns:   1 if an event was returned, 0 if the ring was empty
+//
+// Calls:     Nothing
+//
+// Notes:     Consumer side only
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t t = events->tail;
+
+  if(t == events->head)
+    return 0;
+
+  *event = events->ring[t & (EVENT_RING_SIZE - 1)];
+  events->tail = t + 1;		// release the slot only after it is read
+  return 1;
+}
+
+uint32_t event_ring_dropped(const event_ring_t *events)
+{
+  return events->dropped;
+}
+
+static char *put_decimal(char *p, uint32_t value)
+{
+  char digits[10];
+  int n = 0;
+
+  do {
+    digits[n++] = '0' + value % 10;
+    value /= 10;
+  } while(value);
+
+  while(n)
+    *p++ = digits[--n];
+  return p;
+}
+
+int event_to_text(const digit_event_t *event, char *text)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Formats an event as "<channel> <digit> <start> <end> <confidence>"
+//
+// Input:     event - event to format
+//            text - at least EVENT_TEXT_MAX characters
+//
+// Returns:   Length of the line, excluding the terminator
+//
+// Calls:     Nothing
+//
+// Notes:     Hand-rolled so it is cheap enough for the frame loop
+///////////////////////////////////////////////////////////////////////
+{
+  char *p = text;
+
+  p = put_decimal(p, event->channel);
+  *p++ = ' ';
+  *p++ = event->digit;
+  *p++ = ' ';
+  p = put_decimal(p, event->start_sample);
+  *p++ = ' ';
+  p = put_decimal(p, event->end_sample);
+  *p++ = ' ';
+  p = put_decimal(p, event->confidence);
+  *p++ = '\r';
+  *p++ = '\n';
+  *p = '\0';
+
+  return p - text;
+}
@@ -0,0 +1,32 @@
+#ifndef EVENTS_H_INCLUDED
+#define EVENTS_H_INCLUDED
+
+#include <stdint.h>
+
+// One decoded digit, from the first to the last sample it was heard
+typedef struct {
+  char digit;
+  uint8_t channel;
+  uint8_t confidence;		// 255 = detector agreed for the whole digit
+  uint32_t start_sample;
+  uint32_t end_sample;
+} digit_event_t;
+
+#define EVENT_RING_SIZE 64	// power of two
+#define EVENT_TEXT_MAX 40	// longest line from event_to_text, with terminator
+
+// Single-producer, single-consumer queue of events
+typedef struct {
+  digit_event_t ring[EVENT_RING_SIZE];
+  volatile uint32_t head;	// written by the producer only
+  volatile uint32_t tail;	// written by the consumer only
+  uint32_t dropped;
+} event_ring_t;
+
+void init_event_ring(event_ring_t *events);
+int event_ring_push(event_ring_t *events, const digit_event_t *event);
+int event_ring_pop(event_ring_t *events, digit_event_t *event);
+uint32_t event_ring_dropped(const event_ring_t *events);
+int event_to_text(const digit_event_t *event, char *text);
+
+#endif
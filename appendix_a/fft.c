@@ -15,7 +15,9 @@
 #include <stdlib.h>
 #include <math.h>
 #include "fft.h"
+#include "placement.h"
 
+PLACE_RT_CODE(fft_c)
 void fft_c(int n, COMPLEX *x, COMPLEX *W)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Calculate the radix-2 decimation-in-time FFT.
@@ -75,6 +77,7 @@ void fft_c(int n, COMPLEX *x, COMPLEX *W)
 
 }  // end of fft_c function
 
+PLACE_INIT_CODE(init_W)
 void init_W(int n, COMPLEX *W)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Calculate the twiddle factors needed by the FFT.
@@ -98,3 +101,38 @@ void init_W(int n, COMPLEX *W)
 	W[i].im = (float) sin(-i*a);
     }
 }
+
+PLACE_RT_CODE(fft_split_real)
+void fft_split_real(int n, COMPLEX *Z, float *mag_a, float *mag_b)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Separate the spectra of two real sequences that were
+//            transformed together as a = Z.re, b = Z.im.
+//
+// Input:     n: length of FFT, Z: output of fft_c,
+//            mag_a, mag_b: arrays of n/2+1 floats for the magnitudes
+//
+// Returns:   |A[k]| and |B[k]| for k = 0..n/2 in mag_a and mag_b
+//
+// Calls:     Nothing
+//
+// Notes:     Uses conjugate symmetry of real sequences:
+//            A[k] = (Z[k] + Z*[n-k]) / 2
+//            B[k] = (Z[k] - Z*[n-k]) / 2j
+///////////////////////////////////////////////////////////////////////
+{
+    COMPLEX a, b, zk, zn;
+    int k;
+
+    for(k = 0 ; k <= n/2 ; k++) {
+	zk = Z[k];
+	zn = Z[(n - k) & (n - 1)];	// Z[0] pairs with itself
+
+	a.re = 0.5f*(zk.re + zn.re);
+	a.im = 0.5f*(zk.im - zn.im);
+	b.re = 0.5f*(zk.im + zn.im);
+	b.im = 0.5f*(zn.re - zk.re);
+
+	mag_a[k] = (float) sqrt(a.re*a.re + a.im*a.im);
+	mag_b[k] = (float) sqrt(b.re*b.re + b.im*b.im);
+    }
+}
@@ -10,6 +10,7 @@ typedef struct {
 // function prototypes
 void fft_c(int n, COMPLEX *x, COMPLEX *W);
 void init_W(int n, COMPLEX *W);
+void fft_split_real(int n, COMPLEX *Z, float *mag_a, float *mag_b);
 
 #define MYPI 3.1415926535897932
 #define USE "Usage:%s M(N=2^M) < in_real > out_fft_cmplx\n"
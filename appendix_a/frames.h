@@ -9,10 +9,11 @@
 ///////////////////////////////////////////////////////////////////////
 
 #include "fft.h"
+#include "config.h"
 
 // Necessary definitions
 // frame buffer declarations
-#define BUFFER_COUNT		1024   // buffer length in McASP samples (L+R)
+#define BUFFER_COUNT		256   // buffer length in McASP samples (L+R)
 #define BUFFER_LENGTH		BUFFER_COUNT*2 // two Int16 read from McASP each time
 #define NUM_BUFFERS		3     // don't change this!
 #define SAMPLING_FREQ           48000.0
@@ -21,8 +22,12 @@
 
 // defined in ISRs.c
 void ZeroBuffers();
+void SetEncoderRate(float sample_rate);
 void ProcessBuffer(COMPLEX *twiddle_factors);
 int IsBufferReady();
+void WaitForBuffer();
 int IsOverRun();
+void SetDeadlineRate(float sample_rate);
 void EDMA_Init();
+void BenchmarkCaches(COMPLEX *twiddle_factors);
 
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////
+// Filename: gate.c
+//
+// Synopsis: Energy and zero-crossing gate that lets the analysis
+//   stage skip the FFT on windows that cannot hold a digit. The
+//   window's mean power is compared with an adaptive noise floor
+//   and an absolute minimum. The zero crossings of the window's
+//   loudest hops must reach the rate of the lowest DTFM tone, which
+//   turns away hum and other low-frequency energy; added noise only
+//   raises the rate, so a noisy tone still passes. Only the loudest
+//   hops count, so noise at either end of a partly filled window does
+//   not swamp the tone's count. Costs one
+//   multiply-add and one compare per sample, and a few operations
+//   per hop.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <math.h>
+#include "config.h"
+#include "gate.h"
+#include "placement.h"
+
+// Lowest DTFM tone, with room for frequency error and twist
+#define GATE_LOW_HZ		(697.0f * 0.7f)
+
+// Hops within this share of the loudest one have their crossings counted
+#define GATE_ACTIVE		0.7f
+
+// Noise floor tracking per hop: down at once, up by at most this share
+// of itself, so the floor moves in dB and a tone onset cannot drag it
+// up. Fast while the gate is closed; very slow while it is open, so a
+// steady noise that opened it is eventually absorbed but a held key is
+// not.
+#define GATE_RISE_CLOSED	(1.0f / 32.0f)
+#define GATE_RISE_OPEN		(1.0f / 1024.0f)
+
+PLACE_INIT_CODE(init_gate)
+void init_gate(gate_t *gate, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sets up a gate for a stream
+//
+// Input:     gate - gate to initialize
+//            sample_rate - sample rate of the stream in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     The floor starts at GATE_MIN_LEVEL and settles on the
+//            line's noise within a few hops of quiet. It never goes
+//            under the level where GATE_MIN_LEVEL takes over, so
+//            digital silence cannot pin it at zero.
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  gate->energy = 0.0f;
+  gate->crossings = 0;
+  gate->last = 0;
+  for(i = 0; i < GATE_HOPS; i++) {
+    gate->hop_energy[i] = 0.0f;
+    gate->hop_crossings[i] = 0;
+  }
+  gate->hop_index = 0;
+
+  gate->floor = GATE_MIN_LEVEL * GATE_MIN_LEVEL;
+  gate->open_ratio = powf(10.0f, GATE_OPEN_DB / 10.0f);
+  gate->min_floor = GATE_MIN_LEVEL * GATE_MIN_LEVEL / gate->open_ratio;
+  // A tone pair crosses zero at least twice per period of its lower tone
+  gate->min_crossings = (uint16_t)(2.0f * GATE_LOW_HZ * ANALYSIS_HOP / sample_rate);
+  gate->open = 0;
+}
+
+PLACE_RT_CODE(gate_hop)
+int gate_hop(gate_t *gate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Closes the current hop and decides on the window
+//
+// Input:     gate - gate whose hop has just filled
+//
+// Returns:   Non-zero if the window may hold a digit
+//
+// Calls:     Nothing
+//
+// Notes:     The caller has added the hop's samples to energy and
+//            crossings; both are cleared here for the next hop
+///////////////////////////////////////////////////////////////////////
+{
+  float power = 0.0f, loudest = 0.0f, rise;
+  uint16_t crossings = 0, active = 0;
+  int i;
+
+  gate->hop_energy[gate->hop_index] = gate->energy;
+  gate->hop_crossings[gate->hop_index] = gate->crossings;
+  if(++gate->hop_index >= GATE_HOPS)
+    gate->hop_index = 0;
+  gate->energy = 0.0f;
+  gate->crossings = 0;
+
+  for(i = 0; i < GATE_HOPS; i++) {
+    power += gate->hop_energy[i];
+    if(gate->hop_energy[i] > loudest)
+      loudest = gate->hop_energy[i];
+  }
+  loudest *= GATE_ACTIVE;
+  for(i = 0; i < GATE_HOPS; i++) {
+    if(gate->hop_energy[i] >= loudest) {
+      crossings += gate->hop_crossings[i];
+      active++;
+    }
+  }
+  power *= 1.0f / (GATE_HOPS * ANALYSIS_HOP);
+
+  gate->open = power > gate->floor * gate->open_ratio &&
+	       power > GATE_MIN_LEVEL * GATE_MIN_LEVEL &&
+	       crossings >= active * gate->min_crossings;
+
+  if(power < gate->floor) {
+    gate->floor = power > gate->min_floor ? power : gate->min_floor;
+  }
+  else {
+    rise = power - gate->floor < gate->floor ? power - gate->floor : gate->floor;
+    gate->floor += rise * (gate->open ? GATE_RISE_OPEN : GATE_RISE_CLOSED);
+  }
+
+  return gate->open;
+}
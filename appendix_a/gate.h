@@ -0,0 +1,33 @@
+#ifndef GATE_H_INCLUDED
+#define GATE_H_INCLUDED
+
+#include <stdint.h>
+#include "config.h"
+
+// Hops whose statistics cover one analysis window
+#define GATE_HOPS	((FFT_LENGTH + ANALYSIS_HOP - 1) / ANALYSIS_HOP)
+
+// Per-channel signal gate in front of the FFT. The analysis stage adds
+// up each sample's energy and sign changes in the loop that converts
+// it; at every hop the window's level and the zero-crossing rate of its
+// loudest hops decide whether the window can hold a tone pair at all.
+typedef struct {
+  float energy;			// sum of squares so far in the current hop
+  uint16_t crossings;		// sign changes so far in the current hop
+  int16_t last;			// previous sample, for the sign test
+
+  float hop_energy[GATE_HOPS];	// the last GATE_HOPS hops, oldest first at hop_index
+  uint16_t hop_crossings[GATE_HOPS];
+  uint8_t hop_index;
+
+  float floor;			// noise floor, mean square per sample
+  float min_floor;		// lowest floor that still decides anything
+  float open_ratio;		// window power over floor that opens the gate
+  uint16_t min_crossings;	// fewest sign changes per hop a digit makes
+  uint8_t open;
+} gate_t;
+
+void init_gate(gate_t *gate, float sample_rate);
+int gate_hop(gate_t *gate);
+
+#endif
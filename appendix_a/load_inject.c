@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////
+// Filename: load_inject.c
+//
+// Synopsis: Synthetic load for headroom measurements. Each frame
+//   burns a fixed number of ticks plus optional random jitter. A
+//   sweep raises the fixed part one step at a time, holding each
+//   step for a number of frames, until a frame is missed; the last
+//   step that ran clean is the per-frame budget still available.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <math.h>
+#include "load_inject.h"
+#include "placement.h"
+
+PLACE_INIT_CODE(init_load_inject)
+void init_load_inject(load_inject_t *load, load_clock_t now, uint32_t cycles,
+		      uint8_t jitter, uint32_t jitter_ticks)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sets up a fixed load
+//
+// Input:     load - injector to initialize
+//            now - tick counter to burn against
+//            cycles - busy ticks per frame
+//            jitter, jitter_ticks - LOAD_JITTER_* and its scale
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  load->now = now;
+  load->cycles = cycles;
+  load->jitter = jitter;
+  load->jitter_ticks = jitter_ticks;
+  load->seed = 1;
+  load->sweep = LOAD_SWEEP_IDLE;
+  load->step = 0;
+  load->step_frames = 0;
+  load->frames_left = 0;
+  load->over_runs = 0;
+  load->sustained = 0;
+  load->last = 0;
+}
+
+PLACE_INIT_CODE(load_inject_sweep)
+void load_inject_sweep(load_inject_t *load, uint32_t step, uint32_t step_frames, uint32_t over_runs)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Starts a sweep from no fixed load
+//
+// Input:     load - initialized injector
+//            step - ticks added per step
+//            step_frames - frames per step
+//            over_runs - current over_run count
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Jitter, if any, is added throughout, so the result is the
+//            budget left with that jitter present
+///////////////////////////////////////////////////////////////////////
+{
+  load->cycles = 0;
+  load->sweep = LOAD_SWEEP_RUNNING;
+  load->step = step;
+  load->step_frames = step_frames ? step_frames : 1;
+  load->frames_left = load->step_frames;
+  load->over_runs = over_runs;
+  load->sustained = 0;
+}
+
+PLACE_RT_CODE(jitter_ticks)
+static uint32_t jitter_ticks(load_inject_t *load)
+{
+  float u;
+
+  if(load->jitter == LOAD_JITTER_NONE || !load->jitter_ticks)
+    return 0;
+
+  load->seed = load->seed * 1664525 + 1013904223;
+  if(load->jitter == LOAD_JITTER_UNIFORM)
+    return (uint32_t)(((uint64_t)load->seed * (load->jitter_ticks + 1ull)) >> 32);
+
+  // Exponential by inversion, u in (0, 1]
+  u = ((load->seed >> 8) + 1) * (1.0f / 16777216.0f);
+  u = -logf(u);
+  return (uint32_t)((u < 8.0f ? u : 8.0f) * load->jitter_ticks);
+}
+
+PLACE_RT_CODE(load_inject_frame)
+uint32_t load_inject_frame(load_inject_t *load, uint32_t over_runs)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Burns this frame's synthetic load
+//
+// Input:     load - injector
+//            over_runs - current over_run count
+//
+// Returns:   Ticks burnt
+//
+// Calls:     jitter_ticks
+//
+// Notes:     Call once per frame, in the frame loop. A frame's over_run
+//            is only known at the next EDMA interrupt, so a step is
+//            passed one frame after its last one, and a sweep ends at
+//            the first frame that sees a new over_run. The fixed load
+//            then drops to zero so the line recovers.
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t ticks, start;
+
+  if(load->sweep == LOAD_SWEEP_RUNNING) {
+    if(over_runs != load->over_runs) {
+      load->sweep = LOAD_SWEEP_DONE;
+      load->cycles = 0;
+    }
+    else {
+      if(load->frames_left == 0) {
+	load->sustained = load->cycles;
+	load->cycles += load->step;
+	load->frames_left = load->step_frames;
+      }
+      load->frames_left--;
+    }
+  }
+
+  ticks = load->cycles + jitter_ticks(load);
+  load->last = ticks;
+  if(ticks) {
+    start = load->now();
+    while(load->now() - start < ticks)
+      ;
+  }
+  return ticks;
+}
@@ -0,0 +1,42 @@
+#ifndef LOAD_INJECT_H_INCLUDED
+#define LOAD_INJECT_H_INCLUDED
+
+#include <stdint.h>
+
+// Extra busy ticks per frame on top of the fixed load
+#define LOAD_JITTER_NONE	0
+#define LOAD_JITTER_UNIFORM	1	// 0 .. jitter_ticks, evenly
+#define LOAD_JITTER_EXPONENTIAL	2	// mean jitter_ticks, capped at 8x
+
+// Sweep progress
+#define LOAD_SWEEP_IDLE		0	// fixed load only
+#define LOAD_SWEEP_RUNNING	1
+#define LOAD_SWEEP_DONE		2	// sustained holds the result
+
+// Reads the tick counter the load is burnt against
+typedef uint32_t (*load_clock_t)(void);
+
+// Synthetic per-frame load, for measuring how much more work fits in a
+// frame. Ticks are CPU cycles on the board and nanoseconds on the host.
+// An all-zero load_inject_t burns nothing.
+typedef struct {
+  load_clock_t now;
+  uint32_t cycles;		// fixed busy ticks per frame
+  uint8_t jitter;		// LOAD_JITTER_*
+  uint32_t jitter_ticks;
+  uint32_t seed;
+  uint8_t sweep;		// LOAD_SWEEP_*
+  uint32_t step;		// ticks added per sweep step
+  uint32_t step_frames;		// frames each step must run without an over_run
+  uint32_t frames_left;		// in the current step
+  uint32_t over_runs;		// over_run count when the sweep started
+  uint32_t sustained;		// highest fixed load that ran a whole step
+  uint32_t last;		// ticks burnt in the last frame
+} load_inject_t;
+
+void init_load_inject(load_inject_t *load, load_clock_t now, uint32_t cycles,
+		      uint8_t jitter, uint32_t jitter_ticks);
+void load_inject_sweep(load_inject_t *load, uint32_t step, uint32_t step_frames, uint32_t over_runs);
+uint32_t load_inject_frame(load_inject_t *load, uint32_t over_runs);
+
+#endif
@@ -7,17 +7,30 @@
 
 #include "DSP_Config.h"
 #include "frames.h"
+#include "decoder.h"
 #include "fft.h"
 #include "config.h"
+#include "profile.h"
+#include "report.h"
+#include "rate.h"
+#include "tones.h"
+#include "placement.h"
 
-#define NUM_TWIDDLE_FACTORS BUFFER_COUNT
+#define NUM_TWIDDLE_FACTORS FFT_LENGTH
 
+PLACE_HOT(Twiddle_Factors)
 COMPLEX Twiddle_Factors[NUM_TWIDDLE_FACTORS] = { 0 };
 
 int main()
 {
-  #ifdef ENCODER
+  // caches first, so start-up runs at full speed too
+  Init_Cache();
+
+  #if defined(ENCODER) && !defined(LOOPBACK)
   DSP_Init();
+
+  // serial link for rate commands
+  InitReport();
   #endif
 
   #ifdef DECODER
@@ -27,18 +40,52 @@ int main()
   // Compute twiddle factors
   init_W(NUM_TWIDDLE_FACTORS, Twiddle_Factors);
 
+  // Precompute the analysis window, tracker coefficients and digit timing
+  InitDecoder();
+  #endif
+
+  #ifdef DECODER
+  // Start the cycle counter used for benchmarking
+  PROFILE_INIT();
+
+  // what the caches save per frame, sent with the stats telemetry
+  BenchmarkCaches(Twiddle_Factors);
+  #endif
+
+  #ifdef LOOPBACK
+  // tone pattern rendered into the outgoing frames
+  init_tones(CODEC_FREQUENCY);
+  #endif
+
+  #ifdef DECODER
+
   // initialize EDMA controller
   EDMA_Init();
 
   // initialize DSP for EDMA operation
   DSP_Init_EDMA();
+
+  // interrupt-driven serial output of decoded digits and telemetry
+  InitReport();
   #endif
 
-  // main loop here, process buffer when ready
+  // main loop here, asleep until a buffer is ready
   while(1) {
     #ifdef DECODER
-    if(IsBufferReady()) // process buffers in background
-      ProcessBuffer(Twiddle_Factors);
+    WaitForBuffer(); // IDLE until EDMA_ISR, counting the idle time
+    ProcessBuffer(Twiddle_Factors);
+
+    // change rate now, a whole frame period before the next buffer
+    ApplySampleRate();
+
+    ReportDigits();
+    #endif
+
+    #if defined(ENCODER) && !defined(LOOPBACK)
+    asm(" IDLE"); // nothing to do until the next codec interrupt
+    ApplySampleRate();
     #endif
+
+    PollRateCommand();
   }
 }
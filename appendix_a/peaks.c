@@ -0,0 +1,247 @@
+#include <stdint.h>
+#include "peaks.h"
+#include "config.h"
+#include "dtfm.h"
+#include "window.h"
+#include "placement.h"
+
+// Band the DTFM tones can fall in, with the 3.5% tolerance and a bin of
+// the window's main lobe either side (more for the wider windows, see
+// classify_spectrum)
+#define DTFM_BAND_LOW_HZ	650.0f
+#define DTFM_BAND_HIGH_HZ	1750.0f
+
+PLACE_RT_CODE(interpolate_peak)
+static float interpolate_peak(const float *magnitude, uint16_t k)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Estimates the fractional position of a spectral peak
+//
+// Input:     magnitude - magnitude spectrum
+//            k - index of a local maximum (not 0)
+//
+// Returns:   Peak position in bins, k - 0.5 .. k + 0.5
+//
+// Calls:     Nothing
+//
+// Notes:     Fits a parabola through the peak and its two neighbours
+///////////////////////////////////////////////////////////////////////
+{
+  float a = magnitude[k-1];
+  float b = magnitude[k];
+  float c = magnitude[k+1];
+  float denominator = a - 2*b + c;
+
+  if(denominator == 0)
+    return k;
+
+  return k + 0.5f * (a - c) / denominator;
+}
+
+// Within the window's main lobe of a peak
+#define NEAR_BIN(i, k)	((i) + WINDOW_LOBE_BINS >= (k) && (i) <= (k) + WINDOW_LOBE_BINS)
+
+PLACE_RT_CODE(tone_energy)
+static float tone_energy(const float *magnitude, uint16_t k)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Energy of a tone in the window's main lobe
+//
+// Input:     magnitude - magnitude spectrum
+//            k - index of the tone's peak (not 0)
+//
+// Returns:   Sum of |X|^2 over the peak and WINDOW_TONE_BINS either
+//            side
+//
+// Calls:     Nothing
+//
+// Notes:     Those bins hold all but a few percent of a windowed tone
+//            wherever it falls between bins: three for Hann
+///////////////////////////////////////////////////////////////////////
+{
+  float energy = 0.0f;
+  int i;
+
+  for(i = (int)k - WINDOW_TONE_BINS; i <= (int)k + WINDOW_TONE_BINS; i++)
+    if(i >= 0)
+      energy += magnitude[i] * magnitude[i];
+  return energy;
+}
+
+PLACE_RT_CODE(harmonic_too_strong)
+static int harmonic_too_strong(const float *magnitude, int num_bins, float bin,
+			       uint16_t k, uint16_t other)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Tests a tone's second harmonic
+//
+// Input:     magnitude - magnitude spectrum
+//            num_bins - number of bins searched
+//            bin - interpolated position of the tone
+//            k - index of its peak
+//            other - index of the other tone's peak
+//
+// Returns:   Non-zero if the bin at twice the tone's frequency is within
+//            DTFM_HARMONIC of the tone's peak
+//
+// Calls:     Nothing
+//
+// Notes:     Harmonics past the last bin, or on the other tone's main
+//            lobe (2 x 770 Hz lies one bin from 1477 Hz at 16 kHz), are
+//            not tested here
+///////////////////////////////////////////////////////////////////////
+{
+  uint16_t h = (uint16_t)(2.0f * bin + 0.5f);
+
+  if(h > num_bins || NEAR_BIN(h, other))
+    return 0;
+
+  return magnitude[h] * magnitude[h] * DTFM_HARMONIC > magnitude[k] * magnitude[k];
+}
+
+PLACE_RT_CODE(group_too_strong)
+static int group_too_strong(const float *magnitude, float bin_hz, const float *group,
+			    uint16_t k, float energy)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Tests a tone against the other tones of its group
+//
+// Input:     magnitude - magnitude spectrum
+//            bin_hz - frequency spacing of the bins
+//            group - the four row or the four column frequencies
+//            k - index of the tone's peak
+//            energy - the tone's energy (tone_energy)
+//
+// Returns:   Non-zero if the bin of another tone of the group is
+//            within DTFM_RELATIVE_PEAK of the tone
+//
+// Calls:     Nothing
+//
+// Notes:     Tones on the peak's main lobe are skipped (697 and
+//            770 Hz are a bin apart at 16 kHz)
+///////////////////////////////////////////////////////////////////////
+{
+  uint16_t i, b;
+
+  for(i = 0; i < DTFM_NUM_ROWS; i++) {
+    b = (uint16_t)(group[i] / bin_hz + 0.5f);
+    if(!NEAR_BIN(b, k) && magnitude[b] * magnitude[b] * DTFM_RELATIVE_PEAK > energy)
+      return 1;
+  }
+  return 0;
+}
+
+PLACE_RT_CODE(classify_spectrum)
+char classify_spectrum(const float *magnitude, int num_bins, float bin_hz, peak_state_t *peaks)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Finds the two strongest peaks in a magnitude spectrum and
+//            maps them to a DTFM character
+//
+// Input:     magnitude - |X[k]| for k = 0..num_bins
+//            num_bins - number of bins searched (FFT length / 2)
+//            bin_hz - frequency spacing of the bins
+//            peaks - updated with the strongest peaks found
+//
+// Returns:   Detected character, '\0' if none
+//
+// Calls:     determine_character, tone_energy, group_too_strong,
+//            harmonic_too_strong
+//
+// Notes:     magnitude must hold num_bins + 1 values. A tone pair is
+//            only reported if its twist is within DTFM_NORMAL_TWIST
+//            and DTFM_REVERSE_TWIST, it holds DTFM_MIN_SHARE of the
+//            band's energy, no other tone of either group comes within
+//            DTFM_RELATIVE_PEAK, and neither tone has a second
+//            harmonic within DTFM_HARMONIC. The
+//            band's energy is summed in the peak search; the checks
+//            read a few bins around each tone.
+///////////////////////////////////////////////////////////////////////
+{
+  uint16_t num_peaks = 0;
+  uint16_t peakIndices[FFT_LENGTH/2] = { 0 };
+  uint16_t i, j;
+  uint16_t band_low = (uint16_t)(DTFM_BAND_LOW_HZ / bin_hz) - (WINDOW_TONE_BINS - 1);
+  uint16_t band_high = (uint16_t)(DTFM_BAND_HIGH_HZ / bin_hz) + WINDOW_TONE_BINS;
+  uint16_t row, column, row_rank;
+  float band_energy = 0.0f, row_energy, column_energy;
+  char character;
+
+  // Find all peaks (Identified by being greater than both neighboring magnitudes
+  // and add up the energy of the DTFM band on the way
+  for(i=1; i < num_bins; i++) {
+    if(magnitude[i] > magnitude[i-1] && magnitude[i] > magnitude[i+1]) {
+      peakIndices[num_peaks] = i;
+      num_peaks += 1;
+    }
+    if(i >= band_low && i <= band_high)
+      band_energy += magnitude[i] * magnitude[i];
+  }
+
+  float localMax = 0;
+  uint16_t localMaxIndex = 0;
+  uint16_t localMaxTemp = 0;
+
+  // Bubble sort... cause it's quick and simple... to write...
+  for(j=0; j < num_peaks; j++) {
+    localMax = 0;
+    localMaxIndex = 0;
+
+    // Find max
+    for(i=j; i < num_peaks; i++) {
+      if(magnitude[peakIndices[i]] > localMax) {
+	localMax = magnitude[peakIndices[i]];
+	localMaxIndex = i;
+      }
+    }
+
+    // Swap with jth item
+    localMaxTemp = peakIndices[j];
+    peakIndices[j] = peakIndices[localMaxIndex];
+    peakIndices[localMaxIndex] = localMaxTemp;
+  }
+
+  if(peakIndices[0] != peaks->max_peak) {
+    peaks->max_peak = peakIndices[0];
+    /* printf("New peak index detected: %d\n", peaks->max_peak); */
+  }
+
+  peaks->num_peaks = num_peaks < NUM_REPORTED_PEAKS ? num_peaks : NUM_REPORTED_PEAKS;
+  for(j=0; j < peaks->num_peaks; j++) {
+    peaks->bin[j] = interpolate_peak(magnitude, peakIndices[j]);
+    peaks->magnitude[j] = magnitude[peakIndices[j]];
+  }
+
+  if(num_peaks < 2)
+    return '\0';
+
+  float dtfm_freq_one = peaks->bin[0] * bin_hz;
+  float dtfm_freq_two = peaks->bin[1] * bin_hz;
+
+  character = determine_character(dtfm_freq_one, dtfm_freq_two);
+  if(character == '\0')
+    return '\0';
+
+  // determine_character put one peak in each group; the row tone is lower
+  row_rank = peakIndices[0] < peakIndices[1] ? 0 : 1;
+  row = peakIndices[row_rank];
+  column = peakIndices[1 - row_rank];
+  row_energy = tone_energy(magnitude, row);
+  column_energy = tone_energy(magnitude, column);
+
+  // Twist
+  if(row_energy > column_energy * DTFM_NORMAL_TWIST ||
+     column_energy > row_energy * DTFM_REVERSE_TWIST)
+    return '\0';
+
+  // Signal to total energy in the band
+  if(row_energy + column_energy < band_energy * DTFM_MIN_SHARE)
+    return '\0';
+
+  // Relative peak: each tone against the rest of its group
+  if(group_too_strong(magnitude, bin_hz, dtfm_tone_freqs, row, row_energy) ||
+     group_too_strong(magnitude, bin_hz, dtfm_tone_freqs + DTFM_NUM_ROWS, column, column_energy))
+    return '\0';
+
+  // Second harmonics
+  if(harmonic_too_strong(magnitude, num_bins, peaks->bin[row_rank], row, column) ||
+     harmonic_too_strong(magnitude, num_bins, peaks->bin[1 - row_rank], column, row))
+    return '\0';
+
+  return character;
+}
@@ -0,0 +1,18 @@
+#ifndef PEAKS_H_INCLUDED
+#define PEAKS_H_INCLUDED
+
+#include <stdint.h>
+
+#define NUM_REPORTED_PEAKS 2
+
+// Per-channel result of the peak stage, kept for telemetry
+typedef struct {
+  uint16_t max_peak;				// strongest peak index
+  uint8_t num_peaks;				// valid entries below
+  float bin[NUM_REPORTED_PEAKS];		// interpolated positions, strongest first
+  float magnitude[NUM_REPORTED_PEAKS];
+} peak_state_t;
+
+char classify_spectrum(const float *magnitude, int num_bins, float bin_hz, peak_state_t *peaks);
+
+#endif
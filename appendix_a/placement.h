@@ -0,0 +1,60 @@
+/*
+ * placement.h
+ *
+ * Where data lives on the board. link6748.cmd maps two data sections:
+ *
+ *   "L2RAM" - DSPRAM, the C674x L2 SRAM: single-cycle to L1D, no
+ *             external bus. For what is touched every sample or hop.
+ *   "CE0"   - external mDDR2 SDRAM at 0xC0000000. For what is large
+ *             and seldom read.
+ *
+ * PLACE_HOT marks the decoder's working set (EDMA frames, FFT buffers,
+ * window, twiddles). MEMORY_PLACEMENT in config.h sends it to either
+ * section, so the two can be timed against each other with the frame
+ * counters in the stats telemetry. PLACE_COLD always goes to SDRAM.
+ *
+ * Code is split the same way. PLACE_RT_CODE marks what runs every
+ * sample, frame or hop (the ISRs, ProcessBuffer, the detector, FFT,
+ * peak picking and segmentation). It is linked as one block, ".text:rt",
+ * in DSPRAM, so it maps onto the 32 KB direct-mapped L1P without
+ * evicting itself. PLACE_INIT_CODE marks what only runs at start-up
+ * (codec, I2C, McASP and EDMA set-up) into ".text:init" in SDRAM.
+ * Everything else stays in .text.
+ *
+ * Put the macro on its own line before the definition it places. On the
+ * host there are no sections and all of them expand to nothing.
+ */
+
+#ifndef APPENDIX_A_PLACEMENT_H_
+#define APPENDIX_A_PLACEMENT_H_
+
+#include "config.h"
+
+#define SECTION_INTERNAL	"L2RAM"
+#define SECTION_EXTERNAL	"CE0"
+
+#if MEMORY_PLACEMENT == PLACEMENT_SDRAM
+#define SECTION_HOT		SECTION_EXTERNAL
+#else
+#define SECTION_HOT		SECTION_INTERNAL
+#endif
+#define SECTION_COLD		SECTION_EXTERNAL
+
+#define SECTION_RT_CODE		".text:rt"
+#define SECTION_INIT_CODE	".text:init"
+
+#ifdef _TMS320C6X
+#define PLACE_PRAGMA_(text)	_Pragma(#text)
+#define PLACE_IN_(var, section)	PLACE_PRAGMA_(DATA_SECTION(var, section))
+#define PLACE_CODE_(func, section) PLACE_PRAGMA_(CODE_SECTION(func, section))
+#else
+#define PLACE_IN_(var, section)
+#define PLACE_CODE_(func, section)
+#endif
+
+#define PLACE_HOT(var)		PLACE_IN_(var, SECTION_HOT)
+#define PLACE_COLD(var)		PLACE_IN_(var, SECTION_COLD)
+#define PLACE_RT_CODE(func)	PLACE_CODE_(func, SECTION_RT_CODE)
+#define PLACE_INIT_CODE(func)	PLACE_CODE_(func, SECTION_INIT_CODE)
+
+#endif /* APPENDIX_A_PLACEMENT_H_ */
@@ -0,0 +1,40 @@
+/*
+ * profile.h
+ *
+ * Cycle counting for benchmarking the real-time path.
+ */
+
+#ifndef APPENDIX_A_PROFILE_H_
+#define APPENDIX_A_PROFILE_H_
+
+#include <stdint.h>
+
+#ifdef _TMS320C6X
+#include <c6x.h>
+// Time stamp counter runs at the CPU clock once written
+#define PROFILE_INIT()  (TSCL = 0)
+#define PROFILE_NOW()   ((uint32_t)TSCL)
+#else
+// No cycle counter on the host; host tools time with their own clock
+#define PROFILE_INIT()  ((void)0)
+#define PROFILE_NOW()   ((uint32_t)0)
+#endif
+
+typedef struct
+{
+	uint32_t last;		// cycles of the most recent run
+	uint32_t max;		// worst case since reset
+	uint32_t total;		// sum of all runs, for the average
+	uint32_t count;		// number of runs
+} cycle_stats_t;
+
+#define PROFILE_RECORD(stats, start) \
+	do { \
+		uint32_t elapsed_ = PROFILE_NOW() - (start); \
+		(stats).last = elapsed_; \
+		if(elapsed_ > (stats).max) (stats).max = elapsed_; \
+		(stats).total += elapsed_; \
+		(stats).count++; \
+	} while(0)
+
+#endif /* APPENDIX_A_PROFILE_H_ */
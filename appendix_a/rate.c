@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: rate.c
+//
+// Synopsis: Changes the codec sample rate while the image runs.
+//           The codec is the McASP clock master, so the EDMA keeps
+//           cycling through the buffers across a change; only the
+//           rate-dependent tables need to follow it. Those are all
+//           small (eight SDFT rotations, segment limits, frequency
+//           scale, tone step sizes) and are recomputed in place.
+//           The twiddle factors and the analysis window depend only
+//           on FFT_LENGTH and are kept. With DECIMATION the decoder
+//           follows the codec at 1/DECIMATION of its rate.
+//
+//           Rates are requested over UART2 as "F<kHz>\r", e.g. "F16\r".
+//
+///////////////////////////////////////////////////////////////////////
+
+#include "DSP_Config.h"
+#include "config.h"
+#include "frames.h"
+#include "decoder.h"
+#include "report.h"
+#include "rate.h"
+
+#define RATE_COMMAND_MAX 4	// digits accepted after 'F'
+
+// -1 while no change is waiting
+static volatile int8_t pending_rate = -1;
+
+// command being received on UART2
+static char command[RATE_COMMAND_MAX + 1];
+static int8_t command_length = -1;	// -1 until an 'F' starts a command
+
+static float rate_of(uint8_t nFs)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Maps an AIC3106Fs* setting to its rate in Hz
+//
+// Input:     nFs - one of the AIC3106Fs* rates
+//
+// Returns:   Sample rate in Hz
+//
+// Calls:     Nothing
+//
+// Notes:     Same mapping as SetSampleRate_AIC3106
+///////////////////////////////////////////////////////////////////////
+{
+  switch(nFs) {
+  case AIC3106Fs96kHz: return 96000.0f;
+  case AIC3106Fs32kHz: return 32000.0f;
+  case AIC3106Fs24kHz: return 24000.0f;
+  case AIC3106Fs16kHz: return 16000.0f;
+  case AIC3106Fs12kHz: return 12000.0f;
+  case AIC3106Fs8kHz:  return 8000.0f;
+  default:             return 48000.0f;
+  }
+}
+
+void RequestSampleRate(uint8_t nFs)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Asks for the codec to be switched to another rate
+//
+// Input:     nFs - one of the AIC3106Fs* rates
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Safe from any context; takes effect at the next
+//            ApplySampleRate. Rates above what the decoder supports
+//            are ignored in decoder builds, and so are rates below
+//            the boot rate when decimating, as the decimated band
+//            would no longer hold the DTFM tones.
+///////////////////////////////////////////////////////////////////////
+{
+#ifdef DECODER
+  if(rate_of(nFs) > DECODER_MAX_SAMPLING_FREQUENCY * DECIMATION)
+    return;
+#if DECIMATION > 1
+  if(rate_of(nFs) < CODEC_FREQUENCY)
+    return;
+#endif
+#endif
+  pending_rate = nFs;
+}
+
+int ApplySampleRate()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Carries out a requested rate change
+//
+// Input:     None
+//
+// Returns:   Non-zero if the rate was changed
+//
+// Calls:     SetSampleRate_AIC3106, GetSampleFreq, SetDecoderRate,
+//            ReportStats, SetDeadlineRate, SetEncoderRate
+//
+// Notes:     Call from the main loop right after ProcessBuffer, so the
+//            change has a whole frame period to complete. It is one
+//            or two register writes (see AIC3106_write_table). The
+//            frame being filled during the change holds samples at
+//            both rates; the decoder state restarts before it is
+//            processed and the segmenter rejects the short transient.
+///////////////////////////////////////////////////////////////////////
+{
+  int8_t nFs = pending_rate;
+
+  if(nFs < 0)
+    return 0;
+  pending_rate = -1;
+
+  if(rate_of(nFs) == GetSampleFreq())
+    return 0;
+  if(!SetSampleRate_AIC3106(nFs))
+    return 0;
+
+#ifdef DECODER
+  SetDecoderRate(GetSampleFreq() / DECIMATION);
+  ReportStats(); // last deadline histogram at the old rate
+  SetDeadlineRate(GetSampleFreq());
+#endif
+#ifdef ENCODER
+  SetEncoderRate(GetSampleFreq());
+#endif
+  return 1;
+}
+
+void PollRateCommand()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Reads rate commands from UART2
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     IsDataReady_UART2, Read_UART2, RequestSampleRate
+//
+// Notes:     Never waits; handles whatever bytes have arrived. Unknown
+//            rates and malformed commands are dropped.
+///////////////////////////////////////////////////////////////////////
+{
+  char c;
+  int khz, i;
+
+  while(IsDataReady_UART2()) {
+    c = Read_UART2();
+
+    if(c == 'F') {
+      command_length = 0;
+    }
+    else if(command_length >= 0 && c >= '0' && c <= '9' && command_length < RATE_COMMAND_MAX) {
+      command[command_length++] = c;
+    }
+    else if(command_length > 0 && (c == '\r' || c == '\n')) {
+      khz = 0;
+      for(i = 0;i < command_length;i++)
+	khz = 10*khz + command[i] - '0';
+
+      switch(khz) {
+      case 8:  RequestSampleRate(AIC3106Fs8kHz); break;
+      case 12: RequestSampleRate(AIC3106Fs12kHz); break;
+      case 16: RequestSampleRate(AIC3106Fs16kHz); break;
+      case 24: RequestSampleRate(AIC3106Fs24kHz); break;
+      case 32: RequestSampleRate(AIC3106Fs32kHz); break;
+      case 48: RequestSampleRate(AIC3106Fs48kHz); break;
+      case 96: RequestSampleRate(AIC3106Fs96kHz); break;
+      default: break;
+      }
+      command_length = -1;
+    }
+    else {
+      command_length = -1;
+    }
+  }
+}
@@ -0,0 +1,17 @@
+/*
+ * rate.h
+ *
+ * Runtime sample rate switching. A new rate is requested at any time
+ * and applied by the main loop between frames.
+ */
+
+#ifndef APPENDIX_A_RATE_H_
+#define APPENDIX_A_RATE_H_
+
+#include <stdint.h>
+
+void RequestSampleRate(uint8_t nFs);
+int ApplySampleRate();
+void PollRateCommand();
+
+#endif /* APPENDIX_A_RATE_H_ */
@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: report.c
+//
+// Synopsis: Streams decoder output over UART2 without blocking the
+//           frame loop. Everything goes through Enqueue_UART2; output
+//           that does not fit is dropped and counted, never waited for.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include "DSP_Config.h"
+#include "config.h"
+#include "frames.h"
+#include "profile.h"
+#include "events.h"
+#include "stft.h"
+#include "decoder.h"
+#include "telemetry.h"
+#include "cpu_load.h"
+#include "deadline.h"
+#include "load_inject.h"
+#include "report.h"
+#include "placement.h"
+
+#ifdef TELEMETRY_BINARY
+
+// Worst-case output rate at the boot rate, checked against 80% of the
+// link. ReportSetRate stretches the decimations at higher rates so the
+// byte rate stays the same.
+#define TELEM_HOPS_PER_SEC	(SAMPLING_FREQUENCY / ANALYSIS_HOP)
+#define TELEM_FRAMES_PER_SEC	(SAMPLING_FREQUENCY / BUFFER_COUNT)
+#define TELEM_DIGITS_PER_SEC	13	// 40 ms on + 40 ms off
+#define TELEM_BYTES_PER_SEC \
+	(NUM_DECODE_CHANNELS * TELEM_HOPS_PER_SEC * (TELEM_PEAKS_BYTES + TELEM_OVERHEAD) / TELEMETRY_PEAKS_EVERY + \
+	 NUM_DECODE_CHANNELS * TELEM_HOPS_PER_SEC * (TELEM_SPECTRUM_BYTES(FFT_LENGTH/2 + 1) + TELEM_OVERHEAD) / TELEMETRY_SPECTRUM_EVERY + \
+	 NUM_DECODE_CHANNELS * TELEM_DIGITS_PER_SEC * (TELEM_DIGIT_BYTES + TELEM_OVERHEAD) + \
+	 TELEM_FRAMES_PER_SEC * (TELEM_STATS_BYTES + TELEM_DEADLINE_BYTES + 2*TELEM_OVERHEAD) / TELEMETRY_STATS_EVERY)
+
+// The encoder build runs at a higher rate but never reports
+#if defined(DECODER) && TELEM_BYTES_PER_SEC * 10 > TELEMETRY_BAUD_RATE * 8 / 10
+#error Telemetry does not fit the UART link, raise the TELEMETRY_*_EVERY settings
+#endif
+
+// Built a few times a second and copied straight into the UART queue
+PLACE_COLD(frame)
+static uint8_t frame[TELEM_SPECTRUM_BYTES(FFT_LENGTH/2 + 1) + TELEM_OVERHEAD];
+static uint16_t hop_count = 0;
+static uint16_t frame_count = 0;
+
+// decimations in effect at the current rate
+static uint16_t peaks_every = TELEMETRY_PEAKS_EVERY;
+static uint16_t spectrum_every = TELEMETRY_SPECTRUM_EVERY;
+static uint16_t stats_every = TELEMETRY_STATS_EVERY * DECIMATION;
+
+#endif
+
+static uint32_t current_rate = SAMPLING_FREQUENCY;
+
+// defined in ISRs.c
+extern deadline_t frame_deadline;
+extern load_inject_t frame_load;
+extern cycle_stats_t frame_cycles;
+extern cycle_stats_t render_cycles;
+extern cycle_stats_t cache_off_cycles;
+extern cycle_stats_t cache_on_cycles;
+extern cpu_load_t cpu_load;
+extern volatile uint32_t frame_period;
+
+PLACE_INIT_CODE(InitReport)
+void InitReport()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Starts the serial link used for reporting
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     Init_UART2
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  Init_UART2(TELEMETRY_BAUD_RATE);
+}
+
+#ifdef TELEMETRY_BINARY
+static uint16_t scale_decimation(uint16_t every, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Stretches a decimation for a rate above SAMPLING_FREQUENCY
+//
+// Input:     every - decimation at SAMPLING_FREQUENCY
+//            sample_rate - current rate in Hz
+//
+// Returns:   Decimation giving the same reports per second, at least 1
+//
+// Calls:     Nothing
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t scaled = (uint32_t)(every * sample_rate / SAMPLING_FREQUENCY + 0.5f);
+
+  return scaled > 0 ? scaled : 1;
+}
+#endif
+
+void ReportSetRate(float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Adapts reporting to a new sample rate
+//
+// Input:     sample_rate - new rate in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     scale_decimation
+//
+// Notes:     Does not send anything; after a runtime change call
+//            ReportStats so a host learns the new rate at the sample
+//            number where it starts
+///////////////////////////////////////////////////////////////////////
+{
+  current_rate = (uint32_t)sample_rate;
+#ifdef TELEMETRY_BINARY
+  peaks_every = scale_decimation(TELEMETRY_PEAKS_EVERY, sample_rate);
+  spectrum_every = scale_decimation(TELEMETRY_SPECTRUM_EVERY, sample_rate);
+  // EDMA frames come DECIMATION times as often as decoder frames
+  stats_every = scale_decimation(TELEMETRY_STATS_EVERY * DECIMATION, sample_rate);
+  hop_count = 0;
+  frame_count = 0;
+#endif
+}
+
+PLACE_RT_CODE(ReportHop)
+void ReportHop(const stft_t *stft, uint32_t sample)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sends peak lists and spectra after an analysis hop
+//
+// Input:     stft - analysis stage that just ran
+//            sample - sample number the analysis is stamped with
+//
+// Returns:   Nothing
+//
+// Calls:     telemetry_pack_peaks, telemetry_pack_spectrum,
+//            telemetry_frame, Enqueue_UART2
+//
+// Notes:     Only every TELEMETRY_PEAKS_EVERY / TELEMETRY_SPECTRUM_EVERY
+//            hops; payloads are packed in place behind the header
+///////////////////////////////////////////////////////////////////////
+{
+#ifdef TELEMETRY_BINARY
+  uint8_t *payload = frame + TELEM_HEADER_BYTES;
+  int c, len;
+
+  hop_count++;
+
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+    if(hop_count % peaks_every == 0) {
+      len = telemetry_pack_peaks(payload, sample, c, &stft->peaks[c]);
+      Enqueue_UART2(frame, telemetry_frame(frame, TELEM_TYPE_PEAKS, payload, len));
+    }
+    if(hop_count % spectrum_every == 0) {
+      len = telemetry_pack_spectrum(payload, sample, c, stft_magnitude(stft, c), FFT_LENGTH/2 + 1);
+      Enqueue_UART2(frame, telemetry_frame(frame, TELEM_TYPE_SPECTRUM, payload, len));
+    }
+  }
+#endif
+}
+
+PLACE_RT_CODE(ReportFrame)
+void ReportFrame()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sends configuration and counters every
+//            TELEMETRY_STATS_EVERY frames
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     ReportStats
+//
+// Notes:     The decimation is stretched at higher rates
+///////////////////////////////////////////////////////////////////////
+{
+#ifdef TELEMETRY_BINARY
+  if(++frame_count < stats_every)
+    return;
+  frame_count = 0;
+
+  ReportStats();
+#endif
+}
+
+void ReportStats()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sends configuration and counters now
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     telemetry_pack_stats, telemetry_pack_deadline,
+//            telemetry_frame, Enqueue_UART2
+//
+// Notes:     A deadline frame follows every stats frame
+///////////////////////////////////////////////////////////////////////
+{
+#ifdef TELEMETRY_BINARY
+  telemetry_stats_t stats;
+  uint8_t *payload = frame + TELEM_HEADER_BYTES;
+  int len;
+
+  stats.sample_rate = current_rate;
+  stats.fft_length = FFT_LENGTH;
+  stats.hop = ANALYSIS_HOP;
+  stats.channels = NUM_DECODE_CHANNELS;
+  stats.detector = DETECTOR;
+  stats.load_sweep = frame_load.sweep;
+  stats.sample_clock = board_decoder.sample_clock;
+  stats.frames = frame_deadline.frames;	// sample_clock is in decoder samples
+  stats.hop_cycles_last = board_decoder.hop_cycles.last;
+  stats.hop_cycles_max = board_decoder.hop_cycles.max;
+  stats.over_runs = frame_deadline.over_runs;
+  stats.uart_overflows = TxOverflows_UART2();
+  stats.events_dropped = event_ring_dropped(&board_decoder.events);
+  stats.frame_period = frame_period;
+  stats.frame_cycles_max = frame_cycles.max;
+  stats.render_cycles_max = render_cycles.max;
+  stats.cache_off_cycles = cache_off_cycles.count ? cache_off_cycles.total / cache_off_cycles.count : 0;
+  stats.cache_on_cycles = cache_on_cycles.count ? cache_on_cycles.total / cache_on_cycles.count : 0;
+  stats.load_percent = cpu_load.load_percent;
+  stats.peak_load_percent = cpu_load.peak_percent;
+  stats.average_load = cpu_load_average(&cpu_load);
+  stats.load_cycles = frame_load.last;
+  stats.load_sustained = frame_load.sustained;
+#if DETECTOR == DETECTOR_STFT
+  stats.hops = board_decoder.stft.hops;
+  stats.hops_gated = board_decoder.stft.hops_gated;
+#else
+  stats.hops = board_decoder.hop_cycles.count;
+  stats.hops_gated = 0;
+#endif
+
+  len = telemetry_pack_stats(payload, &stats);
+  Enqueue_UART2(frame, telemetry_frame(frame, TELEM_TYPE_STATS, payload, len));
+
+  len = telemetry_pack_deadline(payload, board_decoder.sample_clock, &frame_deadline);
+  Enqueue_UART2(frame, telemetry_frame(frame, TELEM_TYPE_DEADLINE, payload, len));
+#endif
+}
+
+void ReportDigits()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Moves completed digits from the board decoder's event
+//            ring to the UART2 transmit ring
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     event_ring_pop, Enqueue_UART2
+//
+// Notes:     Events stay queued while the UART is busy; never blocks
+///////////////////////////////////////////////////////////////////////
+{
+  digit_event_t event;
+#ifdef TELEMETRY_BINARY
+  uint8_t digit_frame[TELEM_DIGIT_BYTES + TELEM_OVERHEAD];
+  int len;
+
+  while(TxFree_UART2() >= sizeof(digit_frame) && event_ring_pop(&board_decoder.events, &event)) {
+    len = telemetry_pack_digit(digit_frame + TELEM_HEADER_BYTES, &event);
+    Enqueue_UART2(digit_frame, telemetry_frame(digit_frame, TELEM_TYPE_DIGIT, digit_frame + TELEM_HEADER_BYTES, len));
+  }
+#else
+  char line[EVENT_TEXT_MAX];
+
+  while(TxFree_UART2() >= EVENT_TEXT_MAX && event_ring_pop(&board_decoder.events, &event)) {
+    event_to_text(&event, line);
+    EnqueueString_UART2(line);
+  }
+#endif
+}
@@ -0,0 +1,20 @@
+/*
+ * report.h
+ *
+ * Serial reporting of decoder output over UART2.
+ */
+
+#ifndef APPENDIX_A_REPORT_H_
+#define APPENDIX_A_REPORT_H_
+
+#include <stdint.h>
+#include "stft.h"
+
+void InitReport();
+void ReportSetRate(float sample_rate);
+void ReportHop(const stft_t *stft, uint32_t sample);
+void ReportFrame();
+void ReportStats();
+void ReportDigits();
+
+#endif /* APPENDIX_A_REPORT_H_ */
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////
+// Filename: sdft.c
+//
+// Synopsis: Sliding DFT tracker for the eight DTFM bins. Each
+//   incoming sample updates every bin in O(1):
+//
+//     S_k[n] = W_k * (r * S_k[n-1] + x[n] - r^N * x[n-N])
+//
+//   with W_k = e^(j*2*pi*k/N). The damping factor r < 1 keeps
+//   the recursion stable in single precision, where an undamped
+//   pole on the unit circle would let rounding error build up.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <math.h>
+#include "config.h"
+#include "fft.h"
+#include "dtfm.h"
+#include "arena.h"
+#include "sdft.h"
+#include "placement.h"
+
+#define SDFT_DAMPING		0.99999f
+
+// Per-tone amplitude (in ADC counts) a bin has to exceed to count as
+// present, and the lower level it has to fall under to count as gone
+#define SDFT_ON_AMPLITUDE	300.0f
+#define SDFT_OFF_AMPLITUDE	200.0f
+
+PLACE_INIT_CODE(sdft_alloc)
+int sdft_alloc(sdft_t *sdft, arena_t *arena)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Gives an instance its delay line
+//
+// Input:     sdft - instance to set up
+//            arena - at least SDFT_ARENA_BYTES free
+//
+// Returns:   0 on success, -1 if the arena ran out
+//
+// Calls:     arena_alloc
+//
+// Notes:     Call once, before init_sdft
+///////////////////////////////////////////////////////////////////////
+{
+  sdft->delay_line = arena_alloc(arena, NUM_DECODE_CHANNELS * SDFT_LENGTH * sizeof(float));
+
+  return sdft->delay_line ? 0 : -1;
+}
+
+void init_sdft(sdft_t *sdft, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Computes the bin rotations and clears the tracker state
+//
+// Input:     sdft - instance to initialize
+//            sample_rate - sample rate of the tracked stream in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Each tone is tracked on its nearest integer bin, so the
+//            x[n-N] term needs no phase correction
+///////////////////////////////////////////////////////////////////////
+{
+  int i, c;
+  int k;
+  float amplitude_scale = SDFT_LENGTH / 2.0f;	// |S_k| of a unit sine
+
+  for(i = 0; i < DTFM_NUM_TONES; i++) {
+    k = (int)(dtfm_tone_freqs[i] * SDFT_LENGTH / sample_rate + 0.5f);
+    sdft->rotation[i].re = (float) cos(2.0*MYPI*k/SDFT_LENGTH);
+    sdft->rotation[i].im = (float) sin(2.0*MYPI*k/SDFT_LENGTH);
+  }
+
+  sdft->damping_n = (float) pow(SDFT_DAMPING, SDFT_LENGTH);
+  sdft->on_power = SDFT_ON_AMPLITUDE * amplitude_scale;
+  sdft->on_power *= sdft->on_power;
+  sdft->off_power = SDFT_OFF_AMPLITUDE * amplitude_scale;
+  sdft->off_power *= sdft->off_power;
+
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+    for(i = 0; i < DTFM_NUM_TONES; i++) {
+      sdft->bins[c][i].re = 0.0f;
+      sdft->bins[c][i].im = 0.0f;
+    }
+    for(i = 0; i < SDFT_LENGTH; i++)
+      sdft->delay_line[c][i] = 0.0f;
+    sdft->onset_sample[c] = 0;
+  }
+
+  sdft->delay_index = 0;
+}
+
+PLACE_RT_CODE(sdft_classify)
+static char sdft_classify(const sdft_t *sdft, const COMPLEX *state, char previous)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Turns the current bin energies into a character
+//
+// Input:     sdft - instance the bins belong to
+//            state - the eight bins of one channel
+//            previous - character currently reported
+//
+// Returns:   Character to report, '\0' if none
+//
+// Calls:     determine_character
+//
+// Notes:     Hysteresis: a digit stays until either group drops under
+//            the off threshold
+///////////////////////////////////////////////////////////////////////
+{
+  float power, low_power = 0, high_power = 0;
+  int i, low = 0, high = DTFM_NUM_ROWS;
+
+  for(i = 0; i < DTFM_NUM_TONES; i++) {
+    power = state[i].re * state[i].re + state[i].im * state[i].im;
+    if(i < DTFM_NUM_ROWS) {
+      if(power > low_power) {
+	low_power = power;
+	low = i;
+      }
+    }
+    else if(power > high_power) {
+      high_power = power;
+      high = i;
+    }
+  }
+
+  if(previous != '\0') {
+    if(low_power < sdft->off_power || high_power < sdft->off_power)
+      return '\0';
+  }
+  else if(low_power < sdft->on_power || high_power < sdft->on_power) {
+    return '\0';
+  }
+
+  return determine_character(dtfm_tone_freqs[low], dtfm_tone_freqs[high]);
+}
+
+PLACE_RT_CODE(sdft_process)
+void sdft_process(sdft_t *sdft, const int16_t *pBuf, int num_samples, uint32_t first_sample, char *detected)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Runs the tracker over a block of interleaved L/R samples
+//
+// Input:     sdft - instance to run
+//            pBuf - interleaved samples as delivered by the EDMA
+//            num_samples - number of L/R sample pairs
+//            first_sample - sample number of pBuf[0]
+//            detected - one character per decode channel, updated
+//
+// Returns:   Nothing
+//
+// Calls:     sdft_classify
+//
+// Notes:     Classification runs on every sample, so onsets are
+//            reported as soon as the bins cross the threshold.
+//            onset_sample records when that happened.
+///////////////////////////////////////////////////////////////////////
+{
+  int n, c, i;
+  float x, delta;
+  COMPLEX s, *bins;
+  const COMPLEX *rotation = sdft->rotation;
+  uint16_t d = sdft->delay_index;
+  char next;
+
+  for(n = 0; n < num_samples; n++) {
+    for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+      bins = sdft->bins[c];
+      x = pBuf[c];
+      delta = x - sdft->damping_n * sdft->delay_line[c][d];
+      sdft->delay_line[c][d] = x;
+
+      for(i = 0; i < DTFM_NUM_TONES; i++) {
+	s.re = SDFT_DAMPING * bins[i].re + delta;
+	s.im = SDFT_DAMPING * bins[i].im;
+	bins[i].re = s.re * rotation[i].re - s.im * rotation[i].im;
+	bins[i].im = s.re * rotation[i].im + s.im * rotation[i].re;
+      }
+
+      next = sdft_classify(sdft, bins, detected[c]);
+      if(next != detected[c]) {
+	detected[c] = next;
+	sdft->onset_sample[c] = first_sample + n;
+      }
+    }
+
+    if(++d >= SDFT_LENGTH)
+      d = 0;
+    pBuf += 2;
+  }
+
+  sdft->delay_index = d;
+}
@@ -0,0 +1,35 @@
+#ifndef SDFT_H_INCLUDED
+#define SDFT_H_INCLUDED
+
+#include <stdint.h>
+#include "config.h"
+#include "fft.h"
+#include "dtfm.h"
+#include "arena.h"
+
+// Tracker window. 205 points at 8 kHz put every DTFM tone within
+// 1% of an integer bin (the classic Goertzel choice).
+#define SDFT_LENGTH		205
+
+// One instance of the tracker. The delay line comes from an arena
+// (sdft_alloc); the bins are held inline.
+typedef struct {
+  COMPLEX rotation[DTFM_NUM_TONES];	// W_k
+  float damping_n;			// r^N
+  float on_power, off_power;		// thresholds on |S_k|^2
+
+  COMPLEX bins[NUM_DECODE_CHANNELS][DTFM_NUM_TONES];
+  float (*delay_line)[SDFT_LENGTH];	// [NUM_DECODE_CHANNELS]
+  uint16_t delay_index;
+
+  // sample number at which each channel's detected character last changed
+  uint32_t onset_sample[NUM_DECODE_CHANNELS];
+} sdft_t;
+
+#define SDFT_ARENA_BYTES	ARENA_BYTES(NUM_DECODE_CHANNELS * SDFT_LENGTH * sizeof(float))
+
+int sdft_alloc(sdft_t *sdft, arena_t *arena);
+void init_sdft(sdft_t *sdft, float sample_rate);
+void sdft_process(sdft_t *sdft, const int16_t *pBuf, int num_samples, uint32_t first_sample, char *detected);
+
+#endif
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////
+// Filename: segmenter.c
+//
+// Synopsis: Turns the detector's per-hop (or per-sample) readings
+//   into digits with start and end times. A digit is accepted
+//   once the same reading has lasted DIGIT_MIN_ON_MS, and ends
+//   once a different reading has lasted DIGIT_MIN_OFF_MS, so
+//   dropouts inside a tone do not produce repeated digits.
+//   Completed digits are pushed into the channel's event ring.
+//
+//   Detectors keep hearing a tone for most of their window after
+//   it stops, so readings show tones longer and gaps shorter than
+//   they are. The limits are corrected for the window before they
+//   are compared against readings.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "config.h"
+#include "events.h"
+#include "segmenter.h"
+#include "placement.h"
+
+void init_segmenter(segmenter_t *seg, event_ring_t *events, uint8_t channel, float sample_rate, uint32_t window)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Resets one channel's segmenter
+//
+// Input:     seg - state to initialize
+//            events - ring that receives completed digits
+//            channel - channel number reported in events
+//            sample_rate - sample rate of the decoded stream in Hz
+//            window - analysis window of the detector in samples
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t min_off = (uint32_t)(DIGIT_MIN_OFF_MS * sample_rate / 1000);
+
+  seg->events = events;
+  seg->channel = channel;
+  seg->min_on = (uint32_t)(DIGIT_MIN_ON_MS * sample_rate / 1000) + window/4;
+  seg->min_off = min_off > window + min_off/4 ? min_off - window : min_off/4;
+  seg->candidate = '\0';
+  seg->candidate_start = 0;
+  seg->previous = '\0';
+  seg->previous_start = 0;
+  seg->active = '\0';
+  seg->active_start = 0;
+  seg->agree = 0;
+  seg->total = 0;
+  seg->pending = 0;
+}
+
+PLACE_RT_CODE(segmenter_settle)
+static void segmenter_settle(segmenter_t *seg, uint32_t sample)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Applies the on/off limits to the current candidate, which
+//            has held from candidate_start until sample
+//
+// Input:     seg - channel state
+//            sample - sample number up to which the candidate held
+//
+// Returns:   Nothing
+//
+// Calls:     event_ring_push
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  digit_event_t event;
+  uint32_t held = sample - seg->candidate_start;
+
+  if(seg->active != '\0') {
+    if(seg->candidate == seg->active || held < seg->min_off)
+      return;
+
+    // A different reading held long enough: the digit ended where it began
+    event.digit = seg->active;
+    event.channel = seg->channel;
+    event.confidence = (uint8_t)((255UL * seg->agree) / seg->total);
+    event.start_sample = seg->active_start;
+    event.end_sample = seg->candidate_start;
+    event_ring_push(seg->events, &event);
+
+    seg->active = '\0';
+  }
+
+  if(seg->candidate != '\0' && held >= seg->min_on) {
+    seg->active = seg->candidate;
+    seg->active_start = seg->candidate_start;
+    seg->agree = 1;
+    seg->total = 1;
+    seg->pending = 0;
+  }
+}
+
+PLACE_RT_CODE(segmenter_update)
+void segmenter_update(segmenter_t *seg, char detected, uint32_t sample)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Feeds one detector reading into the state machine
+//
+// Input:     seg - channel state
+//            detected - character reported by the detector, '\0' if none
+//            sample - sample number from which the reading holds
+//
+// Returns:   Nothing
+//
+// Calls:     segmenter_settle
+//
+// Notes:     Readings may arrive at any spacing, but must be in order.
+//            Call at least once per frame so timeouts are noticed.
+///////////////////////////////////////////////////////////////////////
+{
+  uint32_t start = sample;
+
+  if(detected != seg->candidate) {
+    // The old reading lasted until now; judge it before replacing it
+    segmenter_settle(seg, sample);
+
+    // A tone that comes back after a short dropout keeps its start,
+    // so a not yet accepted digit is not split in two
+    if(detected != '\0' && detected == seg->previous && seg->candidate == '\0' &&
+       sample - seg->candidate_start < seg->min_off)
+      start = seg->previous_start;
+
+    seg->previous = seg->candidate;
+    seg->previous_start = seg->candidate_start;
+    seg->candidate = detected;
+    seg->candidate_start = start;
+  }
+
+  if(seg->active != '\0') {
+    // Dropouts only count against the digit once it is heard again
+    if(detected == seg->active) {
+      if(seg->total < 0x7FFF) {
+	seg->agree++;
+	seg->total += seg->pending + 1;
+      }
+      seg->pending = 0;
+    }
+    else if(seg->pending < 0x7FFF) {
+      seg->pending++;
+    }
+  }
+
+  segmenter_settle(seg, sample);
+}
+
+void segmenter_flush(segmenter_t *seg, uint32_t sample)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Ends the digit in progress, if any, without waiting for
+//            the off limit
+//
+// Input:     seg - channel state
+//            sample - sample number at which the input stops
+//
+// Returns:   Nothing
+//
+// Calls:     event_ring_push
+//
+// Notes:     Used when the input is interrupted, e.g. by a rate change
+///////////////////////////////////////////////////////////////////////
+{
+  digit_event_t event;
+
+  if(seg->active == '\0')
+    return;
+
+  event.digit = seg->active;
+  event.channel = seg->channel;
+  event.confidence = (uint8_t)((255UL * seg->agree) / seg->total);
+  event.start_sample = seg->active_start;
+  event.end_sample = seg->candidate == seg->active ? sample : seg->candidate_start;
+  event_ring_push(seg->events, &event);
+
+  seg->active = '\0';
+  seg->candidate = '\0';
+}
@@ -0,0 +1,30 @@
+#ifndef SEGMENTER_H_INCLUDED
+#define SEGMENTER_H_INCLUDED
+
+#include <stdint.h>
+#include "events.h"
+
+// Per-channel digit segmentation state
+typedef struct {
+  event_ring_t *events;		// where completed digits go
+  uint8_t channel;
+  uint32_t min_on;		// samples a digit must last to be accepted
+  uint32_t min_off;		// samples of a different reading that end a digit
+
+  char candidate;		// what the detector currently reports
+  uint32_t candidate_start;
+  char previous;		// the candidate before it
+  uint32_t previous_start;
+
+  char active;			// accepted digit, '\0' between digits
+  uint32_t active_start;
+  uint16_t agree;		// observations of the active digit
+  uint16_t total;		// all observations inside the digit
+  uint16_t pending;		// other readings not yet known to be inside it
+} segmenter_t;
+
+void init_segmenter(segmenter_t *seg, event_ring_t *events, uint8_t channel, float sample_rate, uint32_t window);
+void segmenter_update(segmenter_t *seg, char detected, uint32_t sample);
+void segmenter_flush(segmenter_t *seg, uint32_t sample);
+
+#endif
@@ -8,9 +8,16 @@
 #ifndef APPENDIX_A_SINE_WAVE_H_
 #define APPENDIX_A_SINE_WAVE_H_
 
+#include "placement.h"
+
+// Only the sine table is on the real-time path (tones.c); the others
+// are kept for the lab's waveform functions and live in SDRAM
 const double SINE_WAVE_LUT[NUM_SAMPLES] = {0,0.0013095,0.0026191,0.0039286,0.0052381,0.0065477,0.0078572,0.0091667,0.010476,0.011786,0.013095,0.014404,0.015714,0.017023,0.018333,0.019642,0.020951,0.02226,0.02357,0.024879,0.026188,0.027497,0.028806,0.030115,0.031424,0.032733,0.034042,0.03535,0.036659,0.037968,0.039276,0.040585,0.041893,0.043201,0.04451,0.045818,0.047126,0.048434,0.049742,0.05105,0.052358,0.053665,0.054973,0.056281,0.057588,0.058895,0.060203,0.06151,0.062817,0.064124,0.06543,0.066737,0.068044,0.06935,0.070656,0.071963,0.073269,0.074575,0.07588,0.077186,0.078492,0.079797,0.081102,0.082408,0.083713,0.085018,0.086322,0.087627,0.088931,0.090236,0.09154,0.092844,0.094147,0.095451,0.096755,0.098058,0.099361,0.10066,0.10197,0.10327,0.10457,0.10587,0.10718,0.10848,0.10978,0.11108,0.11238,0.11368,0.11498,0.11629,0.11759,0.11889,0.12019,0.12149,0.12279,0.12409,0.12539,0.12668,0.12798,0.12928,0.13058,0.13188,0.13318,0.13447,0.13577,0.13707,0.13837,0.13966,0.14096,0.14226,0.14355,0.14485,0.14614,0.14744,0.14873,0.15003,0.15132,0.15262,0.15391,0.15521,0.1565,0.15779,0.15909,0.16038,0.16167,0.16296,0.16425,0.16555,0.16684,0.16813,0.16942,0.17071,0.172,0.17329,0.17458,0.17587,0.17716,0.17845,0.17973,0.18102,0.18231,0.1836,0.18489,0.18617,0.18746,0.18874,0.19003,0.19132,0.1926,0.19389,0.19517,0.19645,0.19774,0.19902,0.20031,0.20159,0.20287,0.20415,0.20543,0.20672,0.208,0.20928,0.21056,0.21184,0.21312,0.2144,0.21568,0.21695,0.21823,0.21951,0.22079,0.22206,0.22334,0.22462,0.22589,0.22717,0.22844,0.22972,0.23099,0.23227,0.23354,0.23481,0.23609,0.23736,0.23863,0.2399,0.24117,0.24244,0.24371,0.24498,0.24625,0.24752,0.24879,0.25006,0.25133,0.25259,0.25386,0.25513,0.25639,0.25766,0.25892,0.26019,0.26145,0.26272,0.26398,0.26524,0.26651,0.26777,0.26903,0.27029,0.27155,0.27281,0.27407,0.27533,0.27659,0.27785,0.2791,0.28036,0.28162,0.28287,0.28413,0.28539,0.28664,0.28789,0.28915,0.2904,0.29166,0.29291,0.29416,0.29541,0.29666,0.29791,0.29916,0.30041,0.30166,0.30291,0.30416,0.3054,0.30665,0.3079,0.30914,0.31039,0.31163,0.31288,0.31412,0.31536,0.3166,0.31785,0.31909,0.32033,0.32157,0.32281,0.32405,0.32529,0.32652,0.32776,0.329,0.33023,0.33147,0.33271,0.33394,0.33517,0.33641,0.33764,0.33887,0.34011,0.34134,0.34257,0.3438,0.34503,0.34626,0.34748,0.34871,0.34994,0.35116,0.35239,0.35362,0.35484,0.35606,0.35729,0.35851,0.35973,0.36095,0.36218,0.3634,0.36462,0.36583,0.36705,0.36827,0.36949,0.3707,0.37192,0.37314,0.37435,0.37556,0.37678,0.37799,0.3792,0.38041,0.38162,0.38283,0.38404,0.38525,0.38646,0.38767,0.38888,0.39008,0.39129,0.39249,0.3937,0.3949,0.3961,0.3973,0.39851,0.39971,0.40091,0.40211,0.4033,0.4045,0.4057,0.4069,0.40809,0.40929,0.41048,0.41168,0.41287,0.41406,0.41525,0.41644,0.41763,0.41882,0.42001,0.4212,0.42239,0.42357,0.42476,0.42595,0.42713,0.42831,0.4295,0.43068,0.43186,0.43304,0.43422,0.4354,0.43658,0.43776,0.43893,0.44011,0.44129,0.44246,0.44363,0.44481,0.44598,0.44715,0.44832,0.44949,0.45066,0.45183,0.453,0.45417,0.45533,0.4565,0.45766,0.45883,0.45999,0.46115,0.46231,0.46347,0.46463,0.46579,0.46695,0.46811,0.46927,0.47042,0.47158,0.47273,0.47389,0.47504,0.47619,0.47734,0.47849,0.47964,0.48079,0.48194,0.48308,0.48423,0.48538,0.48652,0.48766,0.48881,0.48995,0.49109,0.49223,0.49337,0.49451,0.49565,0.49678,0.49792,0.49905,0.50019,0.50132,0.50246,0.50359,0.50472,0.50585,0.50698,0.50811,0.50923,0.51036,0.51149,0.51261,0.51373,0.51486,0.51598,0.5171,0.51822,0.51934,0.52046,0.52158,0.52269,0.52381,0.52492,0.52604,0.52715,0.52826,0.52938,0.53049,0.5316,0.53271,0.53381,0.53492,0.53603,0.53713,0.53823,0.53934,0.54044,0.54154,0.54264,0.54374,0.54484,0.54594,0.54703,0.54813,0.54923,0.55032,0.55141,0.5525,0.5536,0.55469,0.55577,0.55686,0.55795,0.55904,0.56012,0.56121,0.56229,0.56337,0.56445,0.56553,0.56661,0.56769,0.56877,0.56985,0.57092,0.572,0.57307,0.57414,0.57521,0.57628,0.57735,0.57842,0.57949,0.58056,0.58162,0.58269,0.58375,0.58481,0.58588,0.58694,0.588,0.58906,0.59011,0.59117,0.59223,0.59328,0.59433,0.59539,0.59644,0.59749,0.59854,0.59959,0.60063,0.60168,0.60273,0.60377,0.60481,0.60586,0.6069,0.60794,0.60898,0.61002,0.61105,0.61209,0.61312,0.61416,0.61519,0.61622,0.61725,0.61828,0.61931,0.62034,0.62137,0.62239,0.62342,0.62444,0.62546,0.62648,0.6275,0.62852,0.62954,0.63056,0.63157,0.63259,0.6336,0.63461,0.63563,0.63664,0.63765,0.63865,0.63966,0.64067,0.64167,0.64268,0.64368,0.64468,0.64568,0.64668,0.64768,0.64868,0.64967,0.65067,0.65166,0.65265,0.65365,0.65464,0.65563,0.65661,0.6576,0.65859,0.65957,0.66056,0.66154,0.66252,0.6635,0.66448,0.66546,0.66643,0.66741,0.66838,0.66936,0.67033,0.6713,0.67227,0.67324,0.67421,0.67517,0.67614,0.6771,0.67807,0.67903,0.67999,0.68095,0.68191,0.68287,0.68382,0.68478,0.68573,0.68668,0.68763,0.68858,0.68953,0.69048,0.69143,0.69237,0.69332,0.69426,0.6952,0.69614,0.69708,0.69802,0.69896,0.69989,0.70083,0.70176,0.70269,0.70363,0.70456,0.70548,0.70641,0.70734,0.70826,0.70919,0.71011,0.71103,0.71195,0.71287,0.71379,0.7147,0.71562,0.71653,0.71745,0.71836,0.71927,0.72018,0.72109,0.72199,0.7229,0.7238,0.72471,0.72561,0.72651,0.72741,0.7283,0.7292,0.7301,0.73099,0.73188,0.73278,0.73367,0.73456,0.73544,0.73633,0.73722,0.7381,0.73898,0.73986,0.74074,0.74162,0.7425,0.74338,0.74425,0.74513,0.746,0.74687,0.74774,0.74861,0.74948,0.75034,0.75121,0.75207,0.75294,0.7538,0.75466,0.75552,0.75637,0.75723,0.75808,0.75894,0.75979,0.76064,0.76149,0.76234,0.76318,0.76403,0.76487,0.76572,0.76656,0.7674,0.76824,0.76908,0.76991,0.77075,0.77158,0.77241,0.77324,0.77407,0.7749,0.77573,0.77655,0.77738,0.7782,0.77902,0.77984,0.78066,0.78148,0.7823,0.78311,0.78393,0.78474,0.78555,0.78636,0.78717,0.78797,0.78878,0.78958,0.79039,0.79119,0.79199,0.79279,0.79359,0.79438,0.79518,0.79597,0.79676,0.79755,0.79834,0.79913,0.79992,0.8007,0.80149,0.80227,0.80305,0.80383,0.80461,0.80538,0.80616,0.80693,0.80771,0.80848,0.80925,0.81002,0.81078,0.81155,0.81231,0.81308,0.81384,0.8146,0.81536,0.81612,0.81687,0.81763,0.81838,0.81913,0.81988,0.82063,0.82138,0.82212,0.82287,0.82361,0.82435,0.8251,0.82583,0.82657,0.82731,0.82804,0.82878,0.82951,0.83024,0.83097,0.8317,0.83242,0.83315,0.83387,0.83459,0.83531,0.83603,0.83675,0.83747,0.83818,0.8389,0.83961,0.84032,0.84103,0.84174,0.84244,0.84315,0.84385,0.84455,0.84525,0.84595,0.84665,0.84735,0.84804,0.84873,0.84943,0.85012,0.8508,0.85149,0.85218,0.85286,0.85355,0.85423,0.85491,0.85559,0.85626,0.85694,0.85761,0.85829,0.85896,0.85963,0.8603,0.86096,0.86163,0.86229,0.86295,0.86361,0.86427,0.86493,0.86559,0.86624,0.8669,0.86755,0.8682,0.86885,0.8695,0.87014,0.87079,0.87143,0.87207,0.87271,0.87335,0.87399,0.87462,0.87526,0.87589,0.87652,0.87715,0.87778,0.87841,0.87903,0.87965,0.88028,0.8809,0.88152,0.88213,0.88275,0.88336,0.88398,0.88459,0.8852,0.88581,0.88641,0.88702,0.88762,0.88823,0.88883,0.88943,0.89002,0.89062,0.89121,0.89181,0.8924,0.89299,0.89358,0.89417,0.89475,0.89533,0.89592,0.8965,0.89708,0.89766,0.89823,0.89881,0.89938,0.89995,0.90052,0.90109,0.90166,0.90222,0.90279,0.90335,0.90391,0.90447,0.90503,0.90558,0.90614,0.90669,0.90724,0.90779,0.90834,0.90889,0.90943,0.90998,0.91052,0.91106,0.9116,0.91214,0.91267,0.91321,0.91374,0.91427,0.9148,0.91533,0.91586,0.91638,0.9169,0.91743,0.91795,0.91847,0.91898,0.9195,0.92001,0.92052,0.92104,0.92154,0.92205,0.92256,0.92306,0.92357,0.92407,0.92457,0.92507,0.92556,0.92606,0.92655,0.92704,0.92753,0.92802,0.92851,0.92899,0.92948,0.92996,0.93044,0.93092,0.9314,0.93187,0.93235,0.93282,0.93329,0.93376,0.93423,0.93469,0.93516,0.93562,0.93608,0.93654,0.937,0.93746,0.93791,0.93837,0.93882,0.93927,0.93972,0.94016,0.94061,0.94105,0.9415,0.94194,0.94238,0.94281,0.94325,0.94368,0.94411,0.94455,0.94497,0.9454,0.94583,0.94625,0.94668,0.9471,0.94752,0.94793,0.94835,0.94876,0.94918,0.94959,0.95,0.95041,0.95081,0.95122,0.95162,0.95202,0.95242,0.95282,0.95322,0.95361,0.95401,0.9544,0.95479,0.95518,0.95556,0.95595,0.95633,0.95671,0.95709,0.95747,0.95785,0.95823,0.9586,0.95897,0.95934,0.95971,0.96008,0.96044,0.96081,0.96117,0.96153,0.96189,0.96225,0.9626,0.96296,0.96331,0.96366,0.96401,0.96435,0.9647,0.96504,0.96539,0.96573,0.96607,0.9664,0.96674,0.96707,0.96741,0.96774,0.96807,0.96839,0.96872,0.96904,0.96937,0.96969,0.97001,0.97032,0.97064,0.97095,0.97127,0.97158,0.97189,0.97219,0.9725,0.9728,0.97311,0.97341,0.97371,0.974,0.9743,0.97459,0.97489,0.97518,0.97547,0.97575,0.97604,0.97632,0.97661,0.97689,0.97717,0.97744,0.97772,0.97799,0.97827,0.97854,0.97881,0.97907,0.97934,0.9796,0.97986,0.98013,0.98038,0.98064,0.9809,0.98115,0.9814,0.98165,0.9819,0.98215,0.9824,0.98264,0.98288,0.98312,0.98336,0.9836,0.98383,0.98407,0.9843,0.98453,0.98476,0.98498,0.98521,0.98543,0.98565,0.98587,0.98609,0.98631,0.98653,0.98674,0.98695,0.98716,0.98737,0.98758,0.98778,0.98798,0.98819,0.98839,0.98858,0.98878,0.98897,0.98917,0.98936,0.98955,0.98974,0.98992,0.99011,0.99029,0.99047,0.99065,0.99083,0.991,0.99118,0.99135,0.99152,0.99169,0.99186,0.99203,0.99219,0.99235,0.99251,0.99267,0.99283,0.99299,0.99314,0.99329,0.99344,0.99359,0.99374,0.99388,0.99403,0.99417,0.99431,0.99445,0.99459,0.99472,0.99485,0.99499,0.99512,0.99524,0.99537,0.9955,0.99562,0.99574,0.99586,0.99598,0.9961,0.99621,0.99632,0.99643,0.99654,0.99665,0.99676,0.99686,0.99697,0.99707,0.99717,0.99726,0.99736,0.99745,0.99755,0.99764,0.99773,0.99781,0.9979,0.99798,0.99807,0.99815,0.99823,0.9983,0.99838,0.99845,0.99852,0.99859,0.99866,0.99873,0.99879,0.99886,0.99892,0.99898,0.99904,0.99909,0.99915,0.9992,0.99925,0.9993,0.99935,0.9994,0.99944,0.99949,0.99953,0.99957,0.9996,0.99964,0.99967,0.99971,0.99974,0.99977,0.99979,0.99982,0.99984,0.99987,0.99989,0.99991,0.99992,0.99994,0.99995,0.99996,0.99997,0.99998,0.99999,0.99999,1,1,1,1,0.99999,0.99999,0.99998,0.99997,0.99996,0.99995,0.99994,0.99992,0.99991,0.99989,0.99987,0.99984,0.99982,0.99979,0.99977,0.99974,0.99971,0.99967,0.99964,0.9996,0.99957,0.99953,0.99949,0.99944,0.9994,0.99935,0.9993,0.99925,0.9992,0.99915,0.99909,0.99904,0.99898,0.99892,0.99886,0.99879,0.99873,0.99866,0.99859,0.99852,0.99845,0.99838,0.9983,0.99823,0.99815,0.99807,0.99798,0.9979,0.99781,0.99773,0.99764,0.99755,0.99745,0.99736,0.99726,0.99717,0.99707,0.99697,0.99686,0.99676,0.99665,0.99654,0.99643,0.99632,0.99621,0.9961,0.99598,0.99586,0.99574,0.99562,0.9955,0.99537,0.99524,0.99512,0.99499,0.99485,0.99472,0.99459,0.99445,0.99431,0.99417,0.99403,0.99388,0.99374,0.99359,0.99344,0.99329,0.99314,0.99299,0.99283,0.99267,0.99251,0.99235,0.99219,0.99203,0.99186,0.99169,0.99152,0.99135,0.99118,0.991,0.99083,0.99065,0.99047,0.99029,0.99011,0.98992,0.98974,0.98955,0.98936,0.98917,0.98897,0.98878,0.98858,0.98839,0.98819,0.98798,0.98778,0.98758,0.98737,0.98716,0.98695,0.98674,0.98653,0.98631,0.98609,0.98587,0.98565,0.98543,0.98521,0.98498,0.98476,0.98453,0.9843,0.98407,0.98383,0.9836,0.98336,0.98312,0.98288,0.98264,0.9824,0.98215,0.9819,0.98165,0.9814,0.98115,0.9809,0.98064,0.98038,0.98013,0.97986,0.9796,0.97934,0.97907,0.97881,0.97854,0.97827,0.97799,0.97772,0.97744,0.97717,0.97689,0.97661,0.97632,0.97604,0.97575,0.97547,0.97518,0.97489,0.97459,0.9743,0.974,0.97371,0.97341,0.97311,0.9728,0.9725,0.97219,0.97189,0.97158,0.97127,0.97095,0.97064,0.97032,0.97001,0.96969,0.96937,0.96904,0.96872,0.96839,0.96807,0.96774,0.96741,0.96707,0.96674,0.9664,0.96607,0.96573,0.96539,0.96504,0.9647,0.96435,0.96401,0.96366,0.96331,0.96296,0.9626,0.96225,0.96189,0.96153,0.96117,0.96081,0.96044,0.96008,0.95971,0.95934,0.95897,0.9586,0.95823,0.95785,0.95747,0.95709,0.95671,0.95633,0.95595,0.95556,0.95518,0.95479,0.9544,0.95401,0.95361,0.95322,0.95282,0.95242,0.95202,0.95162,0.95122,0.95081,0.95041,0.95,0.94959,0.94918,0.94876,0.94835,0.94793,0.94752,0.9471,0.94668,0.94625,0.94583,0.9454,0.94497,0.94455,0.94411,0.94368,0.94325,0.94281,0.94238,0.94194,0.9415,0.94105,0.94061,0.94016,0.93972,0.93927,0.93882,0.93837,0.93791,0.93746,0.937,0.93654,0.93608,0.93562,0.93516,0.93469,0.93423,0.93376,0.93329,0.93282,0.93235,0.93187,0.9314,0.93092,0.93044,0.92996,0.92948,0.92899,0.92851,0.92802,0.92753,0.92704,0.92655,0.92606,0.92556,0.92507,0.92457,0.92407,0.92357,0.92306,0.92256,0.92205,0.92154,0.92104,0.92052,0.92001,0.9195,0.91898,0.91847,0.91795,0.91743,0.9169,0.91638,0.91586,0.91533,0.9148,0.91427,0.91374,0.91321,0.91267,0.91214,0.9116,0.91106,0.91052,0.90998,0.90943,0.90889,0.90834,0.90779,0.90724,0.90669,0.90614,0.90558,0.90503,0.90447,0.90391,0.90335,0.90279,0.90222,0.90166,0.90109,0.90052,0.89995,0.89938,0.89881,0.89823,0.89766,0.89708,0.8965,0.89592,0.89533,0.89475,0.89417,0.89358,0.89299,0.8924,0.89181,0.89121,0.89062,0.89002,0.88943,0.88883,0.88823,0.88762,0.88702,0.88641,0.88581,0.8852,0.88459,0.88398,0.88336,0.88275,0.88213,0.88152,0.8809,0.88028,0.87965,0.87903,0.87841,0.87778,0.87715,0.87652,0.87589,0.87526,0.87462,0.87399,0.87335,0.87271,0.87207,0.87143,0.87079,0.87014,0.8695,0.86885,0.8682,0.86755,0.8669,0.86624,0.86559,0.86493,0.86427,0.86361,0.86295,0.86229,0.86163,0.86096,0.8603,0.85963,0.85896,0.85829,0.85761,0.85694,0.85626,0.85559,0.85491,0.85423,0.85355,0.85286,0.85218,0.85149,0.8508,0.85012,0.84943,0.84873,0.84804,0.84735,0.84665,0.84595,0.84525,0.84455,0.84385,0.84315,0.84244,0.84174,0.84103,0.84032,0.83961,0.8389,0.83818,0.83747,0.83675,0.83603,0.83531,0.83459,0.83387,0.83315,0.83242,0.8317,0.83097,0.83024,0.82951,0.82878,0.82804,0.82731,0.82657,0.82583,0.8251,0.82435,0.82361,0.82287,0.82212,0.82138,0.82063,0.81988,0.81913,0.81838,0.81763,0.81687,0.81612,0.81536,0.8146,0.81384,0.81308,0.81231,0.81155,0.81078,0.81002,0.80925,0.80848,0.80771,0.80693,0.80616,0.80538,0.80461,0.80383,0.80305,0.80227,0.80149,0.8007,0.79992,0.79913,0.79834,0.79755,0.79676,0.79597,0.79518,0.79438,0.79359,0.79279,0.79199,0.79119,0.79039,0.78958,0.78878,0.78797,0.78717,0.78636,0.78555,0.78474,0.78393,0.78311,0.7823,0.78148,0.78066,0.77984,0.77902,0.7782,0.77738,0.77655,0.77573,0.7749,0.77407,0.77324,0.77241,0.77158,0.77075,0.76991,0.76908,0.76824,0.7674,0.76656,0.76572,0.76487,0.76403,0.76318,0.76234,0.76149,0.76064,0.75979,0.75894,0.75808,0.75723,0.75637,0.75552,0.75466,0.7538,0.75294,0.75207,0.75121,0.75034,0.74948,0.74861,0.74774,0.74687,0.746,0.74513,0.74425,0.74338,0.7425,0.74162,0.74074,0.73986,0.73898,0.7381,0.73722,0.73633,0.73544,0.73456,0.73367,0.73278,0.73188,0.73099,0.7301,0.7292,0.7283,0.72741,0.72651,0.72561,0.72471,0.7238,0.7229,0.72199,0.72109,0.72018,0.71927,0.71836,0.71745,0.71653,0.71562,0.7147,0.71379,0.71287,0.71195,0.71103,0.71011,0.70919,0.70826,0.70734,0.70641,0.70548,0.70456,0.70363,0.70269,0.70176,0.70083,0.69989,0.69896,0.69802,0.69708,0.69614,0.6952,0.69426,0.69332,0.69237,0.69143,0.69048,0.68953,0.68858,0.68763,0.68668,0.68573,0.68478,0.68382,0.68287,0.68191,0.68095,0.67999,0.67903,0.67807,0.6771,0.67614,0.67517,0.67421,0.67324,0.67227,0.6713,0.67033,0.66936,0.66838,0.66741,0.66643,0.66546,0.66448,0.6635,0.66252,0.66154,0.66056,0.65957,0.65859,0.6576,0.65661,0.65563,0.65464,0.65365,0.65265,0.65166,0.65067,0.64967,0.64868,0.64768,0.64668,0.64568,0.64468,0.64368,0.64268,0.64167,0.64067,0.63966,0.63865,0.63765,0.63664,0.63563,0.63461,0.6336,0.63259,0.63157,0.63056,0.62954,0.62852,0.6275,0.62648,0.62546,0.62444,0.62342,0.62239,0.62137,0.62034,0.61931,0.61828,0.61725,0.61622,0.61519,0.61416,0.61312,0.61209,0.61105,0.61002,0.60898,0.60794,0.6069,0.60586,0.60481,0.60377,0.60273,0.60168,0.60063,0.59959,0.59854,0.59749,0.59644,0.59539,0.59433,0.59328,0.59223,0.59117,0.59011,0.58906,0.588,0.58694,0.58588,0.58481,0.58375,0.58269,0.58162,0.58056,0.57949,0.57842,0.57735,0.57628,0.57521,0.57414,0.57307,0.572,0.57092,0.56985,0.56877,0.56769,0.56661,0.56553,0.56445,0.56337,0.56229,0.56121,0.56012,0.55904,0.55795,0.55686,0.55577,0.55469,0.5536,0.5525,0.55141,0.55032,0.54923,0.54813,0.54703,0.54594,0.54484,0.54374,0.54264,0.54154,0.54044,0.53934,0.53823,0.53713,0.53603,0.53492,0.53381,0.53271,0.5316,0.53049,0.52938,0.52826,0.52715,0.52604,0.52492,0.52381,0.52269,0.52158,0.52046,0.51934,0.51822,0.5171,0.51598,0.51486,0.51373,0.51261,0.51149,0.51036,0.50923,0.50811,0.50698,0.50585,0.50472,0.50359,0.50246,0.50132,0.50019,0.49905,0.49792,0.49678,0.49565,0.49451,0.49337,0.49223,0.49109,0.48995,0.48881,0.48766,0.48652,0.48538,0.48423,0.48308,0.48194,0.48079,0.47964,0.47849,0.47734,0.47619,0.47504,0.47389,0.47273,0.47158,0.47042,0.46927,0.46811,0.46695,0.46579,0.46463,0.46347,0.46231,0.46115,0.45999,0.45883,0.45766,0.4565,0.45533,0.45417,0.453,0.45183,0.45066,0.44949,0.44832,0.44715,0.44598,0.44481,0.44363,0.44246,0.44129,0.44011,0.43893,0.43776,0.43658,0.4354,0.43422,0.43304,0.43186,0.43068,0.4295,0.42831,0.42713,0.42595,0.42476,0.42357,0.42239,0.4212,0.42001,0.41882,0.41763,0.41644,0.41525,0.41406,0.41287,0.41168,0.41048,0.40929,0.40809,0.4069,0.4057,0.4045,0.4033,0.40211,0.40091,0.39971,0.39851,0.3973,0.3961,0.3949,0.3937,0.39249,0.39129,0.39008,0.38888,0.38767,0.38646,0.38525,0.38404,0.38283,0.38162,0.38041,0.3792,0.37799,0.37678,0.37556,0.37435,0.37314,0.37192,0.3707,0.36949,0.36827,0.36705,0.36583,0.36462,0.3634,0.36218,0.36095,0.35973,0.35851,0.35729,0.35606,0.35484,0.35362,0.35239,0.35116,0.34994,0.34871,0.34748,0.34626,0.34503,0.3438,0.34257,0.34134,0.34011,0.33887,0.33764,0.33641,0.33517,0.33394,0.33271,0.33147,0.33023,0.329,0.32776,0.32652,0.32529,0.32405,0.32281,0.32157,0.32033,0.31909,0.31785,0.3166,0.31536,0.31412,0.31288,0.31163,0.31039,0.30914,0.3079,0.30665,0.3054,0.30416,0.30291,0.30166,0.30041,0.29916,0.29791,0.29666,0.29541,0.29416,0.29291,0.29166,0.2904,0.28915,0.28789,0.28664,0.28539,0.28413,0.28287,0.28162,0.28036,0.2791,0.27785,0.27659,0.27533,0.27407,0.27281,0.27155,0.27029,0.26903,0.26777,0.26651,0.26524,0.26398,0.26272,0.26145,0.26019,0.25892,0.25766,0.25639,0.25513,0.25386,0.25259,0.25133,0.25006,0.24879,0.24752,0.24625,0.24498,0.24371,0.24244,0.24117,0.2399,0.23863,0.23736,0.23609,0.23481,0.23354,0.23227,0.23099,0.22972,0.22844,0.22717,0.22589,0.22462,0.22334,0.22206,0.22079,0.21951,0.21823,0.21695,0.21568,0.2144,0.21312,0.21184,0.21056,0.20928,0.208,0.20672,0.20543,0.20415,0.20287,0.20159,0.20031,0.19902,0.19774,0.19645,0.19517,0.19389,0.1926,0.19132,0.19003,0.18874,0.18746,0.18617,0.18489,0.1836,0.18231,0.18102,0.17973,0.17845,0.17716,0.17587,0.17458,0.17329,0.172,0.17071,0.16942,0.16813,0.16684,0.16555,0.16425,0.16296,0.16167,0.16038,0.15909,0.15779,0.1565,0.15521,0.15391,0.15262,0.15132,0.15003,0.14873,0.14744,0.14614,0.14485,0.14355,0.14226,0.14096,0.13966,0.13837,0.13707,0.13577,0.13447,0.13318,0.13188,0.13058,0.12928,0.12798,0.12668,0.12539,0.12409,0.12279,0.12149,0.12019,0.11889,0.11759,0.11629,0.11498,0.11368,0.11238,0.11108,0.10978,0.10848,0.10718,0.10587,0.10457,0.10327,0.10197,0.10066,0.099361,0.098058,0.096755,0.095451,0.094147,0.092844,0.09154,0.090236,0.088931,0.087627,0.086322,0.085018,0.083713,0.082408,0.081102,0.079797,0.078492,0.077186,0.07588,0.074575,0.073269,0.071963,0.070656,0.06935,0.068044,0.066737,0.06543,0.064124,0.062817,0.06151,0.060203,0.058895,0.057588,0.056281,0.054973,0.053665,0.052358,0.05105,0.049742,0.048434,0.047126,0.045818,0.04451,0.043201,0.041893,0.040585,0.039276,0.037968,0.036659,0.03535,0.034042,0.032733,0.031424,0.030115,0.028806,0.027497,0.026188,0.024879,0.02357,0.02226,0.020951,0.019642,0.018333,0.017023,0.015714,0.014404,0.013095,0.011786,0.010476,0.0091667,0.0078572,0.0065477,0.0052381,0.0039286,0.0026191,0.0013095,1.2246e-16};
+PLACE_COLD(COS_WAVE_LUT)
 const double COS_WAVE_LUT[NUM_SAMPLES]  = {1,1,1,0.99999,0.99999,0.99998,0.99997,0.99996,0.99995,0.99993,0.99991,0.9999,0.99988,0.99986,0.99983,0.99981,0.99978,0.99975,0.99972,0.99969,0.99966,0.99962,0.99959,0.99955,0.99951,0.99946,0.99942,0.99937,0.99933,0.99928,0.99923,0.99918,0.99912,0.99907,0.99901,0.99895,0.99889,0.99883,0.99876,0.9987,0.99863,0.99856,0.99849,0.99841,0.99834,0.99826,0.99819,0.99811,0.99803,0.99794,0.99786,0.99777,0.99768,0.99759,0.9975,0.99741,0.99731,0.99722,0.99712,0.99702,0.99691,0.99681,0.99671,0.9966,0.99649,0.99638,0.99627,0.99615,0.99604,0.99592,0.9958,0.99568,0.99556,0.99543,0.99531,0.99518,0.99505,0.99492,0.99479,0.99465,0.99452,0.99438,0.99424,0.9941,0.99396,0.99381,0.99366,0.99352,0.99337,0.99322,0.99306,0.99291,0.99275,0.99259,0.99243,0.99227,0.99211,0.99194,0.99178,0.99161,0.99144,0.99127,0.99109,0.99092,0.99074,0.99056,0.99038,0.9902,0.99002,0.98983,0.98964,0.98945,0.98926,0.98907,0.98888,0.98868,0.98848,0.98829,0.98808,0.98788,0.98768,0.98747,0.98726,0.98706,0.98684,0.98663,0.98642,0.9862,0.98598,0.98577,0.98554,0.98532,0.9851,0.98487,0.98464,0.98441,0.98418,0.98395,0.98372,0.98348,0.98324,0.983,0.98276,0.98252,0.98227,0.98203,0.98178,0.98153,0.98128,0.98102,0.98077,0.98051,0.98025,0.97999,0.97973,0.97947,0.97921,0.97894,0.97867,0.9784,0.97813,0.97786,0.97758,0.9773,0.97703,0.97675,0.97646,0.97618,0.9759,0.97561,0.97532,0.97503,0.97474,0.97445,0.97415,0.97386,0.97356,0.97326,0.97296,0.97265,0.97235,0.97204,0.97173,0.97142,0.97111,0.9708,0.97048,0.97017,0.96985,0.96953,0.96921,0.96888,0.96856,0.96823,0.9679,0.96757,0.96724,0.96691,0.96657,0.96624,0.9659,0.96556,0.96522,0.96487,0.96453,0.96418,0.96383,0.96348,0.96313,0.96278,0.96242,0.96207,0.96171,0.96135,0.96099,0.96063,0.96026,0.95989,0.95953,0.95916,0.95879,0.95841,0.95804,0.95766,0.95728,0.9569,0.95652,0.95614,0.95576,0.95537,0.95498,0.95459,0.9542,0.95381,0.95342,0.95302,0.95262,0.95222,0.95182,0.95142,0.95102,0.95061,0.9502,0.94979,0.94938,0.94897,0.94856,0.94814,0.94773,0.94731,0.94689,0.94646,0.94604,0.94562,0.94519,0.94476,0.94433,0.9439,0.94347,0.94303,0.94259,0.94216,0.94172,0.94127,0.94083,0.94039,0.93994,0.93949,0.93904,0.93859,0.93814,0.93769,0.93723,0.93677,0.93631,0.93585,0.93539,0.93493,0.93446,0.93399,0.93353,0.93306,0.93258,0.93211,0.93163,0.93116,0.93068,0.9302,0.92972,0.92924,0.92875,0.92826,0.92778,0.92729,0.9268,0.9263,0.92581,0.92531,0.92482,0.92432,0.92382,0.92331,0.92281,0.92231,0.9218,0.92129,0.92078,0.92027,0.91976,0.91924,0.91872,0.91821,0.91769,0.91717,0.91664,0.91612,0.91559,0.91507,0.91454,0.91401,0.91347,0.91294,0.91241,0.91187,0.91133,0.91079,0.91025,0.90971,0.90916,0.90862,0.90807,0.90752,0.90697,0.90642,0.90586,0.90531,0.90475,0.90419,0.90363,0.90307,0.90251,0.90194,0.90137,0.90081,0.90024,0.89967,0.89909,0.89852,0.89794,0.89737,0.89679,0.89621,0.89563,0.89504,0.89446,0.89387,0.89328,0.89269,0.8921,0.89151,0.89092,0.89032,0.88972,0.88913,0.88853,0.88792,0.88732,0.88672,0.88611,0.8855,0.88489,0.88428,0.88367,0.88306,0.88244,0.88182,0.88121,0.88059,0.87997,0.87934,0.87872,0.87809,0.87746,0.87684,0.87621,0.87557,0.87494,0.87431,0.87367,0.87303,0.87239,0.87175,0.87111,0.87046,0.86982,0.86917,0.86852,0.86787,0.86722,0.86657,0.86592,0.86526,0.8646,0.86394,0.86328,0.86262,0.86196,0.86129,0.86063,0.85996,0.85929,0.85862,0.85795,0.85728,0.8566,0.85592,0.85525,0.85457,0.85389,0.8532,0.85252,0.85184,0.85115,0.85046,0.84977,0.84908,0.84839,0.84769,0.847,0.8463,0.8456,0.8449,0.8442,0.8435,0.84279,0.84209,0.84138,0.84067,0.83996,0.83925,0.83854,0.83783,0.83711,0.83639,0.83567,0.83495,0.83423,0.83351,0.83279,0.83206,0.83133,0.8306,0.82987,0.82914,0.82841,0.82768,0.82694,0.8262,0.82547,0.82473,0.82398,0.82324,0.8225,0.82175,0.821,0.82026,0.81951,0.81876,0.818,0.81725,0.81649,0.81574,0.81498,0.81422,0.81346,0.8127,0.81193,0.81117,0.8104,0.80963,0.80886,0.80809,0.80732,0.80655,0.80577,0.805,0.80422,0.80344,0.80266,0.80188,0.80109,0.80031,0.79952,0.79874,0.79795,0.79716,0.79637,0.79557,0.79478,0.79398,0.79319,0.79239,0.79159,0.79079,0.78999,0.78918,0.78838,0.78757,0.78676,0.78595,0.78514,0.78433,0.78352,0.78271,0.78189,0.78107,0.78025,0.77943,0.77861,0.77779,0.77697,0.77614,0.77532,0.77449,0.77366,0.77283,0.772,0.77116,0.77033,0.76949,0.76866,0.76782,0.76698,0.76614,0.7653,0.76445,0.76361,0.76276,0.76191,0.76106,0.76021,0.75936,0.75851,0.75766,0.7568,0.75594,0.75509,0.75423,0.75337,0.7525,0.75164,0.75078,0.74991,0.74904,0.74818,0.74731,0.74644,0.74556,0.74469,0.74382,0.74294,0.74206,0.74118,0.7403,0.73942,0.73854,0.73766,0.73677,0.73589,0.735,0.73411,0.73322,0.73233,0.73144,0.73054,0.72965,0.72875,0.72786,0.72696,0.72606,0.72516,0.72425,0.72335,0.72245,0.72154,0.72063,0.71972,0.71881,0.7179,0.71699,0.71608,0.71516,0.71425,0.71333,0.71241,0.71149,0.71057,0.70965,0.70873,0.7078,0.70688,0.70595,0.70502,0.70409,0.70316,0.70223,0.7013,0.70036,0.69943,0.69849,0.69755,0.69661,0.69567,0.69473,0.69379,0.69285,0.6919,0.69095,0.69001,0.68906,0.68811,0.68716,0.68621,0.68525,0.6843,0.68334,0.68239,0.68143,0.68047,0.67951,0.67855,0.67759,0.67662,0.67566,0.67469,0.67372,0.67276,0.67179,0.67082,0.66984,0.66887,0.6679,0.66692,0.66595,0.66497,0.66399,0.66301,0.66203,0.66105,0.66006,0.65908,0.65809,0.65711,0.65612,0.65513,0.65414,0.65315,0.65216,0.65116,0.65017,0.64917,0.64818,0.64718,0.64618,0.64518,0.64418,0.64318,0.64217,0.64117,0.64016,0.63916,0.63815,0.63714,0.63613,0.63512,0.63411,0.6331,0.63208,0.63107,0.63005,0.62903,0.62801,0.62699,0.62597,0.62495,0.62393,0.6229,0.62188,0.62085,0.61983,0.6188,0.61777,0.61674,0.61571,0.61467,0.61364,0.61261,0.61157,0.61053,0.6095,0.60846,0.60742,0.60638,0.60534,0.60429,0.60325,0.6022,0.60116,0.60011,0.59906,0.59801,0.59696,0.59591,0.59486,0.59381,0.59275,0.5917,0.59064,0.58958,0.58853,0.58747,0.58641,0.58535,0.58428,0.58322,0.58216,0.58109,0.58002,0.57896,0.57789,0.57682,0.57575,0.57468,0.57361,0.57253,0.57146,0.57038,0.56931,0.56823,0.56715,0.56607,0.56499,0.56391,0.56283,0.56175,0.56066,0.55958,0.55849,0.55741,0.55632,0.55523,0.55414,0.55305,0.55196,0.55087,0.54977,0.54868,0.54758,0.54649,0.54539,0.54429,0.54319,0.54209,0.54099,0.53989,0.53879,0.53768,0.53658,0.53547,0.53437,0.53326,0.53215,0.53104,0.52993,0.52882,0.52771,0.5266,0.52548,0.52437,0.52325,0.52214,0.52102,0.5199,0.51878,0.51766,0.51654,0.51542,0.5143,0.51317,0.51205,0.51092,0.5098,0.50867,0.50754,0.50641,0.50528,0.50415,0.50302,0.50189,0.50076,0.49962,0.49849,0.49735,0.49621,0.49508,0.49394,0.4928,0.49166,0.49052,0.48938,0.48824,0.48709,0.48595,0.4848,0.48366,0.48251,0.48136,0.48022,0.47907,0.47792,0.47677,0.47561,0.47446,0.47331,0.47215,0.471,0.46984,0.46869,0.46753,0.46637,0.46521,0.46405,0.46289,0.46173,0.46057,0.45941,0.45824,0.45708,0.45591,0.45475,0.45358,0.45241,0.45125,0.45008,0.44891,0.44774,0.44657,0.44539,0.44422,0.44305,0.44187,0.4407,0.43952,0.43834,0.43717,0.43599,0.43481,0.43363,0.43245,0.43127,0.43009,0.4289,0.42772,0.42654,0.42535,0.42417,0.42298,0.42179,0.42061,0.41942,0.41823,0.41704,0.41585,0.41466,0.41346,0.41227,0.41108,0.40988,0.40869,0.40749,0.4063,0.4051,0.4039,0.40271,0.40151,0.40031,0.39911,0.3979,0.3967,0.3955,0.3943,0.39309,0.39189,0.39068,0.38948,0.38827,0.38706,0.38586,0.38465,0.38344,0.38223,0.38102,0.37981,0.3786,0.37738,0.37617,0.37496,0.37374,0.37253,0.37131,0.3701,0.36888,0.36766,0.36644,0.36522,0.36401,0.36279,0.36156,0.36034,0.35912,0.3579,0.35668,0.35545,0.35423,0.353,0.35178,0.35055,0.34932,0.3481,0.34687,0.34564,0.34441,0.34318,0.34195,0.34072,0.33949,0.33826,0.33702,0.33579,0.33456,0.33332,0.33209,0.33085,0.32962,0.32838,0.32714,0.32591,0.32467,0.32343,0.32219,0.32095,0.31971,0.31847,0.31723,0.31598,0.31474,0.3135,0.31225,0.31101,0.30976,0.30852,0.30727,0.30603,0.30478,0.30353,0.30228,0.30104,0.29979,0.29854,0.29729,0.29604,0.29478,0.29353,0.29228,0.29103,0.28978,0.28852,0.28727,0.28601,0.28476,0.2835,0.28225,0.28099,0.27973,0.27848,0.27722,0.27596,0.2747,0.27344,0.27218,0.27092,0.26966,0.2684,0.26714,0.26587,0.26461,0.26335,0.26209,0.26082,0.25956,0.25829,0.25703,0.25576,0.25449,0.25323,0.25196,0.25069,0.24943,0.24816,0.24689,0.24562,0.24435,0.24308,0.24181,0.24054,0.23927,0.238,0.23672,0.23545,0.23418,0.2329,0.23163,0.23036,0.22908,0.22781,0.22653,0.22526,0.22398,0.2227,0.22143,0.22015,0.21887,0.21759,0.21632,0.21504,0.21376,0.21248,0.2112,0.20992,0.20864,0.20736,0.20608,0.20479,0.20351,0.20223,0.20095,0.19966,0.19838,0.1971,0.19581,0.19453,0.19324,0.19196,0.19067,0.18939,0.1881,0.18682,0.18553,0.18424,0.18295,0.18167,0.18038,0.17909,0.1778,0.17651,0.17522,0.17393,0.17265,0.17136,0.17006,0.16877,0.16748,0.16619,0.1649,0.16361,0.16232,0.16102,0.15973,0.15844,0.15715,0.15585,0.15456,0.15326,0.15197,0.15068,0.14938,0.14809,0.14679,0.1455,0.1442,0.1429,0.14161,0.14031,0.13901,0.13772,0.13642,0.13512,0.13383,0.13253,0.13123,0.12993,0.12863,0.12733,0.12603,0.12474,0.12344,0.12214,0.12084,0.11954,0.11824,0.11694,0.11564,0.11433,0.11303,0.11173,0.11043,0.10913,0.10783,0.10653,0.10522,0.10392,0.10262,0.10132,0.10001,0.098709,0.097406,0.096103,0.094799,0.093496,0.092192,0.090888,0.089583,0.088279,0.086975,0.08567,0.084365,0.08306,0.081755,0.08045,0.079144,0.077839,0.076533,0.075228,0.073922,0.072616,0.071309,0.070003,0.068697,0.06739,0.066084,0.064777,0.06347,0.062163,0.060856,0.059549,0.058242,0.056934,0.055627,0.054319,0.053012,0.051704,0.050396,0.049088,0.04778,0.046472,0.045164,0.043856,0.042547,0.041239,0.03993,0.038622,0.037313,0.036005,0.034696,0.033387,0.032078,0.030769,0.02946,0.028151,0.026842,0.025533,0.024224,0.022915,0.021606,0.020297,0.018987,0.017678,0.016369,0.015059,0.01375,0.01244,0.011131,0.0098214,0.0085119,0.0072024,0.0058929,0.0045834,0.0032739,0.0019643,0.00065477,-0.00065477,-0.0019643,-0.0032739,-0.0045834,-0.0058929,-0.0072024,-0.0085119,-0.0098214,-0.011131,-0.01244,-0.01375,-0.015059,-0.016369,-0.017678,-0.018987,-0.020297,-0.021606,-0.022915,-0.024224,-0.025533,-0.026842,-0.028151,-0.02946,-0.030769,-0.032078,-0.033387,-0.034696,-0.036005,-0.037313,-0.038622,-0.03993,-0.041239,-0.042547,-0.043856,-0.045164,-0.046472,-0.04778,-0.049088,-0.050396,-0.051704,-0.053012,-0.054319,-0.055627,-0.056934,-0.058242,-0.059549,-0.060856,-0.062163,-0.06347,-0.064777,-0.066084,-0.06739,-0.068697,-0.070003,-0.071309,-0.072616,-0.073922,-0.075228,-0.076533,-0.077839,-0.079144,-0.08045,-0.081755,-0.08306,-0.084365,-0.08567,-0.086975,-0.088279,-0.089583,-0.090888,-0.092192,-0.093496,-0.094799,-0.096103,-0.097406,-0.098709,-0.10001,-0.10132,-0.10262,-0.10392,-0.10522,-0.10653,-0.10783,-0.10913,-0.11043,-0.11173,-0.11303,-0.11433,-0.11564,-0.11694,-0.11824,-0.11954,-0.12084,-0.12214,-0.12344,-0.12474,-0.12603,-0.12733,-0.12863,-0.12993,-0.13123,-0.13253,-0.13383,-0.13512,-0.13642,-0.13772,-0.13901,-0.14031,-0.14161,-0.1429,-0.1442,-0.1455,-0.14679,-0.14809,-0.14938,-0.15068,-0.15197,-0.15326,-0.15456,-0.15585,-0.15715,-0.15844,-0.15973,-0.16102,-0.16232,-0.16361,-0.1649,-0.16619,-0.16748,-0.16877,-0.17006,-0.17136,-0.17265,-0.17393,-0.17522,-0.17651,-0.1778,-0.17909,-0.18038,-0.18167,-0.18295,-0.18424,-0.18553,-0.18682,-0.1881,-0.18939,-0.19067,-0.19196,-0.19324,-0.19453,-0.19581,-0.1971,-0.19838,-0.19966,-0.20095,-0.20223,-0.20351,-0.20479,-0.20608,-0.20736,-0.20864,-0.20992,-0.2112,-0.21248,-0.21376,-0.21504,-0.21632,-0.21759,-0.21887,-0.22015,-0.22143,-0.2227,-0.22398,-0.22526,-0.22653,-0.22781,-0.22908,-0.23036,-0.23163,-0.2329,-0.23418,-0.23545,-0.23672,-0.238,-0.23927,-0.24054,-0.24181,-0.24308,-0.24435,-0.24562,-0.24689,-0.24816,-0.24943,-0.25069,-0.25196,-0.25323,-0.25449,-0.25576,-0.25703,-0.25829,-0.25956,-0.26082,-0.26209,-0.26335,-0.26461,-0.26587,-0.26714,-0.2684,-0.26966,-0.27092,-0.27218,-0.27344,-0.2747,-0.27596,-0.27722,-0.27848,-0.27973,-0.28099,-0.28225,-0.2835,-0.28476,-0.28601,-0.28727,-0.28852,-0.28978,-0.29103,-0.29228,-0.29353,-0.29478,-0.29604,-0.29729,-0.29854,-0.29979,-0.30104,-0.30228,-0.30353,-0.30478,-0.30603,-0.30727,-0.30852,-0.30976,-0.31101,-0.31225,-0.3135,-0.31474,-0.31598,-0.31723,-0.31847,-0.31971,-0.32095,-0.32219,-0.32343,-0.32467,-0.32591,-0.32714,-0.32838,-0.32962,-0.33085,-0.33209,-0.33332,-0.33456,-0.33579,-0.33702,-0.33826,-0.33949,-0.34072,-0.34195,-0.34318,-0.34441,-0.34564,-0.34687,-0.3481,-0.34932,-0.35055,-0.35178,-0.353,-0.35423,-0.35545,-0.35668,-0.3579,-0.35912,-0.36034,-0.36156,-0.36279,-0.36401,-0.36522,-0.36644,-0.36766,-0.36888,-0.3701,-0.37131,-0.37253,-0.37374,-0.37496,-0.37617,-0.37738,-0.3786,-0.37981,-0.38102,-0.38223,-0.38344,-0.38465,-0.38586,-0.38706,-0.38827,-0.38948,-0.39068,-0.39189,-0.39309,-0.3943,-0.3955,-0.3967,-0.3979,-0.39911,-0.40031,-0.40151,-0.40271,-0.4039,-0.4051,-0.4063,-0.40749,-0.40869,-0.40988,-0.41108,-0.41227,-0.41346,-0.41466,-0.41585,-0.41704,-0.41823,-0.41942,-0.42061,-0.42179,-0.42298,-0.42417,-0.42535,-0.42654,-0.42772,-0.4289,-0.43009,-0.43127,-0.43245,-0.43363,-0.43481,-0.43599,-0.43717,-0.43834,-0.43952,-0.4407,-0.44187,-0.44305,-0.44422,-0.44539,-0.44657,-0.44774,-0.44891,-0.45008,-0.45125,-0.45241,-0.45358,-0.45475,-0.45591,-0.45708,-0.45824,-0.45941,-0.46057,-0.46173,-0.46289,-0.46405,-0.46521,-0.46637,-0.46753,-0.46869,-0.46984,-0.471,-0.47215,-0.47331,-0.47446,-0.47561,-0.47677,-0.47792,-0.47907,-0.48022,-0.48136,-0.48251,-0.48366,-0.4848,-0.48595,-0.48709,-0.48824,-0.48938,-0.49052,-0.49166,-0.4928,-0.49394,-0.49508,-0.49621,-0.49735,-0.49849,-0.49962,-0.50076,-0.50189,-0.50302,-0.50415,-0.50528,-0.50641,-0.50754,-0.50867,-0.5098,-0.51092,-0.51205,-0.51317,-0.5143,-0.51542,-0.51654,-0.51766,-0.51878,-0.5199,-0.52102,-0.52214,-0.52325,-0.52437,-0.52548,-0.5266,-0.52771,-0.52882,-0.52993,-0.53104,-0.53215,-0.53326,-0.53437,-0.53547,-0.53658,-0.53768,-0.53879,-0.53989,-0.54099,-0.54209,-0.54319,-0.54429,-0.54539,-0.54649,-0.54758,-0.54868,-0.54977,-0.55087,-0.55196,-0.55305,-0.55414,-0.55523,-0.55632,-0.55741,-0.55849,-0.55958,-0.56066,-0.56175,-0.56283,-0.56391,-0.56499,-0.56607,-0.56715,-0.56823,-0.56931,-0.57038,-0.57146,-0.57253,-0.57361,-0.57468,-0.57575,-0.57682,-0.57789,-0.57896,-0.58002,-0.58109,-0.58216,-0.58322,-0.58428,-0.58535,-0.58641,-0.58747,-0.58853,-0.58958,-0.59064,-0.5917,-0.59275,-0.59381,-0.59486,-0.59591,-0.59696,-0.59801,-0.59906,-0.60011,-0.60116,-0.6022,-0.60325,-0.60429,-0.60534,-0.60638,-0.60742,-0.60846,-0.6095,-0.61053,-0.61157,-0.61261,-0.61364,-0.61467,-0.61571,-0.61674,-0.61777,-0.6188,-0.61983,-0.62085,-0.62188,-0.6229,-0.62393,-0.62495,-0.62597,-0.62699,-0.62801,-0.62903,-0.63005,-0.63107,-0.63208,-0.6331,-0.63411,-0.63512,-0.63613,-0.63714,-0.63815,-0.63916,-0.64016,-0.64117,-0.64217,-0.64318,-0.64418,-0.64518,-0.64618,-0.64718,-0.64818,-0.64917,-0.65017,-0.65116,-0.65216,-0.65315,-0.65414,-0.65513,-0.65612,-0.65711,-0.65809,-0.65908,-0.66006,-0.66105,-0.66203,-0.66301,-0.66399,-0.66497,-0.66595,-0.66692,-0.6679,-0.66887,-0.66984,-0.67082,-0.67179,-0.67276,-0.67372,-0.67469,-0.67566,-0.67662,-0.67759,-0.67855,-0.67951,-0.68047,-0.68143,-0.68239,-0.68334,-0.6843,-0.68525,-0.68621,-0.68716,-0.68811,-0.68906,-0.69001,-0.69095,-0.6919,-0.69285,-0.69379,-0.69473,-0.69567,-0.69661,-0.69755,-0.69849,-0.69943,-0.70036,-0.7013,-0.70223,-0.70316,-0.70409,-0.70502,-0.70595,-0.70688,-0.7078,-0.70873,-0.70965,-0.71057,-0.71149,-0.71241,-0.71333,-0.71425,-0.71516,-0.71608,-0.71699,-0.7179,-0.71881,-0.71972,-0.72063,-0.72154,-0.72245,-0.72335,-0.72425,-0.72516,-0.72606,-0.72696,-0.72786,-0.72875,-0.72965,-0.73054,-0.73144,-0.73233,-0.73322,-0.73411,-0.735,-0.73589,-0.73677,-0.73766,-0.73854,-0.73942,-0.7403,-0.74118,-0.74206,-0.74294,-0.74382,-0.74469,-0.74556,-0.74644,-0.74731,-0.74818,-0.74904,-0.74991,-0.75078,-0.75164,-0.7525,-0.75337,-0.75423,-0.75509,-0.75594,-0.7568,-0.75766,-0.75851,-0.75936,-0.76021,-0.76106,-0.76191,-0.76276,-0.76361,-0.76445,-0.7653,-0.76614,-0.76698,-0.76782,-0.76866,-0.76949,-0.77033,-0.77116,-0.772,-0.77283,-0.77366,-0.77449,-0.77532,-0.77614,-0.77697,-0.77779,-0.77861,-0.77943,-0.78025,-0.78107,-0.78189,-0.78271,-0.78352,-0.78433,-0.78514,-0.78595,-0.78676,-0.78757,-0.78838,-0.78918,-0.78999,-0.79079,-0.79159,-0.79239,-0.79319,-0.79398,-0.79478,-0.79557,-0.79637,-0.79716,-0.79795,-0.79874,-0.79952,-0.80031,-0.80109,-0.80188,-0.80266,-0.80344,-0.80422,-0.805,-0.80577,-0.80655,-0.80732,-0.80809,-0.80886,-0.80963,-0.8104,-0.81117,-0.81193,-0.8127,-0.81346,-0.81422,-0.81498,-0.81574,-0.81649,-0.81725,-0.818,-0.81876,-0.81951,-0.82026,-0.821,-0.82175,-0.8225,-0.82324,-0.82398,-0.82473,-0.82547,-0.8262,-0.82694,-0.82768,-0.82841,-0.82914,-0.82987,-0.8306,-0.83133,-0.83206,-0.83279,-0.83351,-0.83423,-0.83495,-0.83567,-0.83639,-0.83711,-0.83783,-0.83854,-0.83925,-0.83996,-0.84067,-0.84138,-0.84209,-0.84279,-0.8435,-0.8442,-0.8449,-0.8456,-0.8463,-0.847,-0.84769,-0.84839,-0.84908,-0.84977,-0.85046,-0.85115,-0.85184,-0.85252,-0.8532,-0.85389,-0.85457,-0.85525,-0.85592,-0.8566,-0.85728,-0.85795,-0.85862,-0.85929,-0.85996,-0.86063,-0.86129,-0.86196,-0.86262,-0.86328,-0.86394,-0.8646,-0.86526,-0.86592,-0.86657,-0.86722,-0.86787,-0.86852,-0.86917,-0.86982,-0.87046,-0.87111,-0.87175,-0.87239,-0.87303,-0.87367,-0.87431,-0.87494,-0.87557,-0.87621,-0.87684,-0.87746,-0.87809,-0.87872,-0.87934,-0.87997,-0.88059,-0.88121,-0.88182,-0.88244,-0.88306,-0.88367,-0.88428,-0.88489,-0.8855,-0.88611,-0.88672,-0.88732,-0.88792,-0.88853,-0.88913,-0.88972,-0.89032,-0.89092,-0.89151,-0.8921,-0.89269,-0.89328,-0.89387,-0.89446,-0.89504,-0.89563,-0.89621,-0.89679,-0.89737,-0.89794,-0.89852,-0.89909,-0.89967,-0.90024,-0.90081,-0.90137,-0.90194,-0.90251,-0.90307,-0.90363,-0.90419,-0.90475,-0.90531,-0.90586,-0.90642,-0.90697,-0.90752,-0.90807,-0.90862,-0.90916,-0.90971,-0.91025,-0.91079,-0.91133,-0.91187,-0.91241,-0.91294,-0.91347,-0.91401,-0.91454,-0.91507,-0.91559,-0.91612,-0.91664,-0.91717,-0.91769,-0.91821,-0.91872,-0.91924,-0.91976,-0.92027,-0.92078,-0.92129,-0.9218,-0.92231,-0.92281,-0.92331,-0.92382,-0.92432,-0.92482,-0.92531,-0.92581,-0.9263,-0.9268,-0.92729,-0.92778,-0.92826,-0.92875,-0.92924,-0.92972,-0.9302,-0.93068,-0.93116,-0.93163,-0.93211,-0.93258,-0.93306,-0.93353,-0.93399,-0.93446,-0.93493,-0.93539,-0.93585,-0.93631,-0.93677,-0.93723,-0.93769,-0.93814,-0.93859,-0.93904,-0.93949,-0.93994,-0.94039,-0.94083,-0.94127,-0.94172,-0.94216,-0.94259,-0.94303,-0.94347,-0.9439,-0.94433,-0.94476,-0.94519,-0.94562,-0.94604,-0.94646,-0.94689,-0.94731,-0.94773,-0.94814,-0.94856,-0.94897,-0.94938,-0.94979,-0.9502,-0.95061,-0.95102,-0.95142,-0.95182,-0.95222,-0.95262,-0.95302,-0.95342,-0.95381,-0.9542,-0.95459,-0.95498,-0.95537,-0.95576,-0.95614,-0.95652,-0.9569,-0.95728,-0.95766,-0.95804,-0.95841,-0.95879,-0.95916,-0.95953,-0.95989,-0.96026,-0.96063,-0.96099,-0.96135,-0.96171,-0.96207,-0.96242,-0.96278,-0.96313,-0.96348,-0.96383,-0.96418,-0.96453,-0.96487,-0.96522,-0.96556,-0.9659,-0.96624,-0.96657,-0.96691,-0.96724,-0.96757,-0.9679,-0.96823,-0.96856,-0.96888,-0.96921,-0.96953,-0.96985,-0.97017,-0.97048,-0.9708,-0.97111,-0.97142,-0.97173,-0.97204,-0.97235,-0.97265,-0.97296,-0.97326,-0.97356,-0.97386,-0.97415,-0.97445,-0.97474,-0.97503,-0.97532,-0.97561,-0.9759,-0.97618,-0.97646,-0.97675,-0.97703,-0.9773,-0.97758,-0.97786,-0.97813,-0.9784,-0.97867,-0.97894,-0.97921,-0.97947,-0.97973,-0.97999,-0.98025,-0.98051,-0.98077,-0.98102,-0.98128,-0.98153,-0.98178,-0.98203,-0.98227,-0.98252,-0.98276,-0.983,-0.98324,-0.98348,-0.98372,-0.98395,-0.98418,-0.98441,-0.98464,-0.98487,-0.9851,-0.98532,-0.98554,-0.98577,-0.98598,-0.9862,-0.98642,-0.98663,-0.98684,-0.98706,-0.98726,-0.98747,-0.98768,-0.98788,-0.98808,-0.98829,-0.98848,-0.98868,-0.98888,-0.98907,-0.98926,-0.98945,-0.98964,-0.98983,-0.99002,-0.9902,-0.99038,-0.99056,-0.99074,-0.99092,-0.99109,-0.99127,-0.99144,-0.99161,-0.99178,-0.99194,-0.99211,-0.99227,-0.99243,-0.99259,-0.99275,-0.99291,-0.99306,-0.99322,-0.99337,-0.99352,-0.99366,-0.99381,-0.99396,-0.9941,-0.99424,-0.99438,-0.99452,-0.99465,-0.99479,-0.99492,-0.99505,-0.99518,-0.99531,-0.99543,-0.99556,-0.99568,-0.9958,-0.99592,-0.99604,-0.99615,-0.99627,-0.99638,-0.99649,-0.9966,-0.99671,-0.99681,-0.99691,-0.99702,-0.99712,-0.99722,-0.99731,-0.99741,-0.9975,-0.99759,-0.99768,-0.99777,-0.99786,-0.99794,-0.99803,-0.99811,-0.99819,-0.99826,-0.99834,-0.99841,-0.99849,-0.99856,-0.99863,-0.9987,-0.99876,-0.99883,-0.99889,-0.99895,-0.99901,-0.99907,-0.99912,-0.99918,-0.99923,-0.99928,-0.99933,-0.99937,-0.99942,-0.99946,-0.99951,-0.99955,-0.99959,-0.99962,-0.99966,-0.99969,-0.99972,-0.99975,-0.99978,-0.99981,-0.99983,-0.99986,-0.99988,-0.9999,-0.99991,-0.99993,-0.99995,-0.99996,-0.99997,-0.99998,-0.99999,-0.99999,-1,-1,-1};
+PLACE_COLD(SQUARE_WAVE_LUT)
 const double SQUARE_WAVE_LUT[NUM_SAMPLES] = {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,-1};
+PLACE_COLD(SAWTOOTH_WAVE_LUT)
 const double SAWTOOTH_WAVE_LUT[NUM_SAMPLES] = {-1,-0.99917,-0.99833,-0.9975,-0.99667,-0.99583,-0.995,-0.99416,-0.99333,-0.9925,-0.99166,-0.99083,-0.99,-0.98916,-0.98833,-0.98749,-0.98666,-0.98583,-0.98499,-0.98416,-0.98333,-0.98249,-0.98166,-0.98083,-0.97999,-0.97916,-0.97832,-0.97749,-0.97666,-0.97582,-0.97499,-0.97416,-0.97332,-0.97249,-0.97165,-0.97082,-0.96999,-0.96915,-0.96832,-0.96749,-0.96665,-0.96582,-0.96499,-0.96415,-0.96332,-0.96248,-0.96165,-0.96082,-0.95998,-0.95915,-0.95832,-0.95748,-0.95665,-0.95581,-0.95498,-0.95415,-0.95331,-0.95248,-0.95165,-0.95081,-0.94998,-0.94915,-0.94831,-0.94748,-0.94664,-0.94581,-0.94498,-0.94414,-0.94331,-0.94248,-0.94164,-0.94081,-0.93997,-0.93914,-0.93831,-0.93747,-0.93664,-0.93581,-0.93497,-0.93414,-0.93331,-0.93247,-0.93164,-0.9308,-0.92997,-0.92914,-0.9283,-0.92747,-0.92664,-0.9258,-0.92497,-0.92414,-0.9233,-0.92247,-0.92163,-0.9208,-0.91997,-0.91913,-0.9183,-0.91747,-0.91663,-0.9158,-0.91496,-0.91413,-0.9133,-0.91246,-0.91163,-0.9108,-0.90996,-0.90913,-0.9083,-0.90746,-0.90663,-0.90579,-0.90496,-0.90413,-0.90329,-0.90246,-0.90163,-0.90079,-0.89996,-0.89912,-0.89829,-0.89746,-0.89662,-0.89579,-0.89496,-0.89412,-0.89329,-0.89246,-0.89162,-0.89079,-0.88995,-0.88912,-0.88829,-0.88745,-0.88662,-0.88579,-0.88495,-0.88412,-0.88328,-0.88245,-0.88162,-0.88078,-0.87995,-0.87912,-0.87828,-0.87745,-0.87662,-0.87578,-0.87495,-0.87411,-0.87328,-0.87245,-0.87161,-0.87078,-0.86995,-0.86911,-0.86828,-0.86744,-0.86661,-0.86578,-0.86494,-0.86411,-0.86328,-0.86244,-0.86161,-0.86078,-0.85994,-0.85911,-0.85827,-0.85744,-0.85661,-0.85577,-0.85494,-0.85411,-0.85327,-0.85244,-0.8516,-0.85077,-0.84994,-0.8491,-0.84827,-0.84744,-0.8466,-0.84577,-0.84494,-0.8441,-0.84327,-0.84243,-0.8416,-0.84077,-0.83993,-0.8391,-0.83827,-0.83743,-0.8366,-0.83576,-0.83493,-0.8341,-0.83326,-0.83243,-0.8316,-0.83076,-0.82993,-0.8291,-0.82826,-0.82743,-0.82659,-0.82576,-0.82493,-0.82409,-0.82326,-0.82243,-0.82159,-0.82076,-0.81992,-0.81909,-0.81826,-0.81742,-0.81659,-0.81576,-0.81492,-0.81409,-0.81326,-0.81242,-0.81159,-0.81075,-0.80992,-0.80909,-0.80825,-0.80742,-0.80659,-0.80575,-0.80492,-0.80409,-0.80325,-0.80242,-0.80158,-0.80075,-0.79992,-0.79908,-0.79825,-0.79742,-0.79658,-0.79575,-0.79491,-0.79408,-0.79325,-0.79241,-0.79158,-0.79075,-0.78991,-0.78908,-0.78825,-0.78741,-0.78658,-0.78574,-0.78491,-0.78408,-0.78324,-0.78241,-0.78158,-0.78074,-0.77991,-0.77907,-0.77824,-0.77741,-0.77657,-0.77574,-0.77491,-0.77407,-0.77324,-0.77241,-0.77157,-0.77074,-0.7699,-0.76907,-0.76824,-0.7674,-0.76657,-0.76574,-0.7649,-0.76407,-0.76323,-0.7624,-0.76157,-0.76073,-0.7599,-0.75907,-0.75823,-0.7574,-0.75657,-0.75573,-0.7549,-0.75406,-0.75323,-0.7524,-0.75156,-0.75073,-0.7499,-0.74906,-0.74823,-0.74739,-0.74656,-0.74573,-0.74489,-0.74406,-0.74323,-0.74239,-0.74156,-0.74073,-0.73989,-0.73906,-0.73822,-0.73739,-0.73656,-0.73572,-0.73489,-0.73406,-0.73322,-0.73239,-0.73155,-0.73072,-0.72989,-0.72905,-0.72822,-0.72739,-0.72655,-0.72572,-0.72489,-0.72405,-0.72322,-0.72238,-0.72155,-0.72072,-0.71988,-0.71905,-0.71822,-0.71738,-0.71655,-0.71571,-0.71488,-0.71405,-0.71321,-0.71238,-0.71155,-0.71071,-0.70988,-0.70905,-0.70821,-0.70738,-0.70654,-0.70571,-0.70488,-0.70404,-0.70321,-0.70238,-0.70154,-0.70071,-0.69987,-0.69904,-0.69821,-0.69737,-0.69654,-0.69571,-0.69487,-0.69404,-0.69321,-0.69237,-0.69154,-0.6907,-0.68987,-0.68904,-0.6882,-0.68737,-0.68654,-0.6857,-0.68487,-0.68404,-0.6832,-0.68237,-0.68153,-0.6807,-0.67987,-0.67903,-0.6782,-0.67737,-0.67653,-0.6757,-0.67486,-0.67403,-0.6732,-0.67236,-0.67153,-0.6707,-0.66986,-0.66903,-0.6682,-0.66736,-0.66653,-0.66569,-0.66486,-0.66403,-0.66319,-0.66236,-0.66153,-0.66069,-0.65986,-0.65902,-0.65819,-0.65736,-0.65652,-0.65569,-0.65486,-0.65402,-0.65319,-0.65236,-0.65152,-0.65069,-0.64985,-0.64902,-0.64819,-0.64735,-0.64652,-0.64569,-0.64485,-0.64402,-0.64318,-0.64235,-0.64152,-0.64068,-0.63985,-0.63902,-0.63818,-0.63735,-0.63652,-0.63568,-0.63485,-0.63401,-0.63318,-0.63235,-0.63151,-0.63068,-0.62985,-0.62901,-0.62818,-0.62734,-0.62651,-0.62568,-0.62484,-0.62401,-0.62318,-0.62234,-0.62151,-0.62068,-0.61984,-0.61901,-0.61817,-0.61734,-0.61651,-0.61567,-0.61484,-0.61401,-0.61317,-0.61234,-0.6115,-0.61067,-0.60984,-0.609,-0.60817,-0.60734,-0.6065,-0.60567,-0.60484,-0.604,-0.60317,-0.60233,-0.6015,-0.60067,-0.59983,-0.599,-0.59817,-0.59733,-0.5965,-0.59566,-0.59483,-0.594,-0.59316,-0.59233,-0.5915,-0.59066,-0.58983,-0.589,-0.58816,-0.58733,-0.58649,-0.58566,-0.58483,-0.58399,-0.58316,-0.58233,-0.58149,-0.58066,-0.57982,-0.57899,-0.57816,-0.57732,-0.57649,-0.57566,-0.57482,-0.57399,-0.57316,-0.57232,-0.57149,-0.57065,-0.56982,-0.56899,-0.56815,-0.56732,-0.56649,-0.56565,-0.56482,-0.56398,-0.56315,-0.56232,-0.56148,-0.56065,-0.55982,-0.55898,-0.55815,-0.55732,-0.55648,-0.55565,-0.55481,-0.55398,-0.55315,-0.55231,-0.55148,-0.55065,-0.54981,-0.54898,-0.54815,-0.54731,-0.54648,-0.54564,-0.54481,-0.54398,-0.54314,-0.54231,-0.54148,-0.54064,-0.53981,-0.53897,-0.53814,-0.53731,-0.53647,-0.53564,-0.53481,-0.53397,-0.53314,-0.53231,-0.53147,-0.53064,-0.5298,-0.52897,-0.52814,-0.5273,-0.52647,-0.52564,-0.5248,-0.52397,-0.52313,-0.5223,-0.52147,-0.52063,-0.5198,-0.51897,-0.51813,-0.5173,-0.51647,-0.51563,-0.5148,-0.51396,-0.51313,-0.5123,-0.51146,-0.51063,-0.5098,-0.50896,-0.50813,-0.50729,-0.50646,-0.50563,-0.50479,-0.50396,-0.50313,-0.50229,-0.50146,-0.50063,-0.49979,-0.49896,-0.49812,-0.49729,-0.49646,-0.49562,-0.49479,-0.49396,-0.49312,-0.49229,-0.49145,-0.49062,-0.48979,-0.48895,-0.48812,-0.48729,-0.48645,-0.48562,-0.48479,-0.48395,-0.48312,-0.48228,-0.48145,-0.48062,-0.47978,-0.47895,-0.47812,-0.47728,-0.47645,-0.47561,-0.47478,-0.47395,-0.47311,-0.47228,-0.47145,-0.47061,-0.46978,-0.46895,-0.46811,-0.46728,-0.46644,-0.46561,-0.46478,-0.46394,-0.46311,-0.46228,-0.46144,-0.46061,-0.45977,-0.45894,-0.45811,-0.45727,-0.45644,-0.45561,-0.45477,-0.45394,-0.45311,-0.45227,-0.45144,-0.4506,-0.44977,-0.44894,-0.4481,-0.44727,-0.44644,-0.4456,-0.44477,-0.44393,-0.4431,-0.44227,-0.44143,-0.4406,-0.43977,-0.43893,-0.4381,-0.43727,-0.43643,-0.4356,-0.43476,-0.43393,-0.4331,-0.43226,-0.43143,-0.4306,-0.42976,-0.42893,-0.4281,-0.42726,-0.42643,-0.42559,-0.42476,-0.42393,-0.42309,-0.42226,-0.42143,-0.42059,-0.41976,-0.41892,-0.41809,-0.41726,-0.41642,-0.41559,-0.41476,-0.41392,-0.41309,-0.41226,-0.41142,-0.41059,-0.40975,-0.40892,-0.40809,-0.40725,-0.40642,-0.40559,-0.40475,-0.40392,-0.40308,-0.40225,-0.40142,-0.40058,-0.39975,-0.39892,-0.39808,-0.39725,-0.39642,-0.39558,-0.39475,-0.39391,-0.39308,-0.39225,-0.39141,-0.39058,-0.38975,-0.38891,-0.38808,-0.38724,-0.38641,-0.38558,-0.38474,-0.38391,-0.38308,-0.38224,-0.38141,-0.38058,-0.37974,-0.37891,-0.37807,-0.37724,-0.37641,-0.37557,-0.37474,-0.37391,-0.37307,-0.37224,-0.3714,-0.37057,-0.36974,-0.3689,-0.36807,-0.36724,-0.3664,-0.36557,-0.36474,-0.3639,-0.36307,-0.36223,-0.3614,-0.36057,-0.35973,-0.3589,-0.35807,-0.35723,-0.3564,-0.35556,-0.35473,-0.3539,-0.35306,-0.35223,-0.3514,-0.35056,-0.34973,-0.3489,-0.34806,-0.34723,-0.34639,-0.34556,-0.34473,-0.34389,-0.34306,-0.34223,-0.34139,-0.34056,-0.33972,-0.33889,-0.33806,-0.33722,-0.33639,-0.33556,-0.33472,-0.33389,-0.33306,-0.33222,-0.33139,-0.33055,-0.32972,-0.32889,-0.32805,-0.32722,-0.32639,-0.32555,-0.32472,-0.32388,-0.32305,-0.32222,-0.32138,-0.32055,-0.31972,-0.31888,-0.31805,-0.31722,-0.31638,-0.31555,-0.31471,-0.31388,-0.31305,-0.31221,-0.31138,-0.31055,-0.30971,-0.30888,-0.30805,-0.30721,-0.30638,-0.30554,-0.30471,-0.30388,-0.30304,-0.30221,-0.30138,-0.30054,-0.29971,-0.29887,-0.29804,-0.29721,-0.29637,-0.29554,-0.29471,-0.29387,-0.29304,-0.29221,-0.29137,-0.29054,-0.2897,-0.28887,-0.28804,-0.2872,-0.28637,-0.28554,-0.2847,-0.28387,-0.28303,-0.2822,-0.28137,-0.28053,-0.2797,-0.27887,-0.27803,-0.2772,-0.27637,-0.27553,-0.2747,-0.27386,-0.27303,-0.2722,-0.27136,-0.27053,-0.2697,-0.26886,-0.26803,-0.26719,-0.26636,-0.26553,-0.26469,-0.26386,-0.26303,-0.26219,-0.26136,-0.26053,-0.25969,-0.25886,-0.25802,-0.25719,-0.25636,-0.25552,-0.25469,-0.25386,-0.25302,-0.25219,-0.25135,-0.25052,-0.24969,-0.24885,-0.24802,-0.24719,-0.24635,-0.24552,-0.24469,-0.24385,-0.24302,-0.24218,-0.24135,-0.24052,-0.23968,-0.23885,-0.23802,-0.23718,-0.23635,-0.23551,-0.23468,-0.23385,-0.23301,-0.23218,-0.23135,-0.23051,-0.22968,-0.22885,-0.22801,-0.22718,-0.22634,-0.22551,-0.22468,-0.22384,-0.22301,-0.22218,-0.22134,-0.22051,-0.21967,-0.21884,-0.21801,-0.21717,-0.21634,-0.21551,-0.21467,-0.21384,-0.21301,-0.21217,-0.21134,-0.2105,-0.20967,-0.20884,-0.208,-0.20717,-0.20634,-0.2055,-0.20467,-0.20383,-0.203,-0.20217,-0.20133,-0.2005,-0.19967,-0.19883,-0.198,-0.19717,-0.19633,-0.1955,-0.19466,-0.19383,-0.193,-0.19216,-0.19133,-0.1905,-0.18966,-0.18883,-0.18799,-0.18716,-0.18633,-0.18549,-0.18466,-0.18383,-0.18299,-0.18216,-0.18133,-0.18049,-0.17966,-0.17882,-0.17799,-0.17716,-0.17632,-0.17549,-0.17466,-0.17382,-0.17299,-0.17216,-0.17132,-0.17049,-0.16965,-0.16882,-0.16799,-0.16715,-0.16632,-0.16549,-0.16465,-0.16382,-0.16298,-0.16215,-0.16132,-0.16048,-0.15965,-0.15882,-0.15798,-0.15715,-0.15632,-0.15548,-0.15465,-0.15381,-0.15298,-0.15215,-0.15131,-0.15048,-0.14965,-0.14881,-0.14798,-0.14714,-0.14631,-0.14548,-0.14464,-0.14381,-0.14298,-0.14214,-0.14131,-0.14048,-0.13964,-0.13881,-0.13797,-0.13714,-0.13631,-0.13547,-0.13464,-0.13381,-0.13297,-0.13214,-0.1313,-0.13047,-0.12964,-0.1288,-0.12797,-0.12714,-0.1263,-0.12547,-0.12464,-0.1238,-0.12297,-0.12213,-0.1213,-0.12047,-0.11963,-0.1188,-0.11797,-0.11713,-0.1163,-0.11546,-0.11463,-0.1138,-0.11296,-0.11213,-0.1113,-0.11046,-0.10963,-0.1088,-0.10796,-0.10713,-0.10629,-0.10546,-0.10463,-0.10379,-0.10296,-0.10213,-0.10129,-0.10046,-0.099625,-0.098791,-0.097957,-0.097124,-0.09629,-0.095456,-0.094623,-0.093789,-0.092955,-0.092122,-0.091288,-0.090454,-0.089621,-0.088787,-0.087953,-0.08712,-0.086286,-0.085452,-0.084619,-0.083785,-0.082951,-0.082118,-0.081284,-0.08045,-0.079617,-0.078783,-0.077949,-0.077115,-0.076282,-0.075448,-0.074614,-0.073781,-0.072947,-0.072113,-0.07128,-0.070446,-0.069612,-0.068779,-0.067945,-0.067111,-0.066278,-0.065444,-0.06461,-0.063777,-0.062943,-0.062109,-0.061276,-0.060442,-0.059608,-0.058774,-0.057941,-0.057107,-0.056273,-0.05544,-0.054606,-0.053772,-0.052939,-0.052105,-0.051271,-0.050438,-0.049604,-0.04877,-0.047937,-0.047103,-0.046269,-0.045436,-0.044602,-0.043768,-0.042935,-0.042101,-0.041267,-0.040434,-0.0396,-0.038766,-0.037932,-0.037099,-0.036265,-0.035431,-0.034598,-0.033764,-0.03293,-0.032097,-0.031263,-0.030429,-0.029596,-0.028762,-0.027928,-0.027095,-0.026261,-0.025427,-0.024594,-0.02376,-0.022926,-0.022093,-0.021259,-0.020425,-0.019591,-0.018758,-0.017924,-0.01709,-0.016257,-0.015423,-0.014589,-0.013756,-0.012922,-0.012088,-0.011255,-0.010421,-0.0095873,-0.0087536,-0.00792,-0.0070863,-0.0062526,-0.0054189,-0.0045852,-0.0037516,-0.0029179,-0.0020842,-0.0012505,-0.00041684,0.00041684,0.0012505,0.0020842,0.0029179,0.0037516,0.0045852,0.0054189,0.0062526,0.0070863,0.00792,0.0087536,0.0095873,0.010421,0.011255,0.012088,0.012922,0.013756,0.014589,0.015423,0.016257,0.01709,0.017924,0.018758,0.019591,0.020425,0.021259,0.022093,0.022926,0.02376,0.024594,0.025427,0.026261,0.027095,0.027928,0.028762,0.029596,0.030429,0.031263,0.032097,0.03293,0.033764,0.034598,0.035431,0.036265,0.037099,0.037932,0.038766,0.0396,0.040434,0.041267,0.042101,0.042935,0.043768,0.044602,0.045436,0.046269,0.047103,0.047937,0.04877,0.049604,0.050438,0.051271,0.052105,0.052939,0.053772,0.054606,0.05544,0.056273,0.057107,0.057941,0.058774,0.059608,0.060442,0.061276,0.062109,0.062943,0.063777,0.06461,0.065444,0.066278,0.067111,0.067945,0.068779,0.069612,0.070446,0.07128,0.072113,0.072947,0.073781,0.074614,0.075448,0.076282,0.077115,0.077949,0.078783,0.079617,0.08045,0.081284,0.082118,0.082951,0.083785,0.084619,0.085452,0.086286,0.08712,0.087953,0.088787,0.089621,0.090454,0.091288,0.092122,0.092955,0.093789,0.094623,0.095456,0.09629,0.097124,0.097957,0.098791,0.099625,0.10046,0.10129,0.10213,0.10296,0.10379,0.10463,0.10546,0.10629,0.10713,0.10796,0.1088,0.10963,0.11046,0.1113,0.11213,0.11296,0.1138,0.11463,0.11546,0.1163,0.11713,0.11797,0.1188,0.11963,0.12047,0.1213,0.12213,0.12297,0.1238,0.12464,0.12547,0.1263,0.12714,0.12797,0.1288,0.12964,0.13047,0.1313,0.13214,0.13297,0.13381,0.13464,0.13547,0.13631,0.13714,0.13797,0.13881,0.13964,0.14048,0.14131,0.14214,0.14298,0.14381,0.14464,0.14548,0.14631,0.14714,0.14798,0.14881,0.14965,0.15048,0.15131,0.15215,0.15298,0.15381,0.15465,0.15548,0.15632,0.15715,0.15798,0.15882,0.15965,0.16048,0.16132,0.16215,0.16298,0.16382,0.16465,0.16549,0.16632,0.16715,0.16799,0.16882,0.16965,0.17049,0.17132,0.17216,0.17299,0.17382,0.17466,0.17549,0.17632,0.17716,0.17799,0.17882,0.17966,0.18049,0.18133,0.18216,0.18299,0.18383,0.18466,0.18549,0.18633,0.18716,0.18799,0.18883,0.18966,0.1905,0.19133,0.19216,0.193,0.19383,0.19466,0.1955,0.19633,0.19717,0.198,0.19883,0.19967,0.2005,0.20133,0.20217,0.203,0.20383,0.20467,0.2055,0.20634,0.20717,0.208,0.20884,0.20967,0.2105,0.21134,0.21217,0.21301,0.21384,0.21467,0.21551,0.21634,0.21717,0.21801,0.21884,0.21967,0.22051,0.22134,0.22218,0.22301,0.22384,0.22468,0.22551,0.22634,0.22718,0.22801,0.22885,0.22968,0.23051,0.23135,0.23218,0.23301,0.23385,0.23468,0.23551,0.23635,0.23718,0.23802,0.23885,0.23968,0.24052,0.24135,0.24218,0.24302,0.24385,0.24469,0.24552,0.24635,0.24719,0.24802,0.24885,0.24969,0.25052,0.25135,0.25219,0.25302,0.25386,0.25469,0.25552,0.25636,0.25719,0.25802,0.25886,0.25969,0.26053,0.26136,0.26219,0.26303,0.26386,0.26469,0.26553,0.26636,0.26719,0.26803,0.26886,0.2697,0.27053,0.27136,0.2722,0.27303,0.27386,0.2747,0.27553,0.27637,0.2772,0.27803,0.27887,0.2797,0.28053,0.28137,0.2822,0.28303,0.28387,0.2847,0.28554,0.28637,0.2872,0.28804,0.28887,0.2897,0.29054,0.29137,0.29221,0.29304,0.29387,0.29471,0.29554,0.29637,0.29721,0.29804,0.29887,0.29971,0.30054,0.30138,0.30221,0.30304,0.30388,0.30471,0.30554,0.30638,0.30721,0.30805,0.30888,0.30971,0.31055,0.31138,0.31221,0.31305,0.31388,0.31471,0.31555,0.31638,0.31722,0.31805,0.31888,0.31972,0.32055,0.32138,0.32222,0.32305,0.32388,0.32472,0.32555,0.32639,0.32722,0.32805,0.32889,0.32972,0.33055,0.33139,0.33222,0.33306,0.33389,0.33472,0.33556,0.33639,0.33722,0.33806,0.33889,0.33972,0.34056,0.34139,0.34223,0.34306,0.34389,0.34473,0.34556,0.34639,0.34723,0.34806,0.3489,0.34973,0.35056,0.3514,0.35223,0.35306,0.3539,0.35473,0.35556,0.3564,0.35723,0.35807,0.3589,0.35973,0.36057,0.3614,0.36223,0.36307,0.3639,0.36474,0.36557,0.3664,0.36724,0.36807,0.3689,0.36974,0.37057,0.3714,0.37224,0.37307,0.37391,0.37474,0.37557,0.37641,0.37724,0.37807,0.37891,0.37974,0.38058,0.38141,0.38224,0.38308,0.38391,0.38474,0.38558,0.38641,0.38724,0.38808,0.38891,0.38975,0.39058,0.39141,0.39225,0.39308,0.39391,0.39475,0.39558,0.39642,0.39725,0.39808,0.39892,0.39975,0.40058,0.40142,0.40225,0.40308,0.40392,0.40475,0.40559,0.40642,0.40725,0.40809,0.40892,0.40975,0.41059,0.41142,0.41226,0.41309,0.41392,0.41476,0.41559,0.41642,0.41726,0.41809,0.41892,0.41976,0.42059,0.42143,0.42226,0.42309,0.42393,0.42476,0.42559,0.42643,0.42726,0.4281,0.42893,0.42976,0.4306,0.43143,0.43226,0.4331,0.43393,0.43476,0.4356,0.43643,0.43727,0.4381,0.43893,0.43977,0.4406,0.44143,0.44227,0.4431,0.44393,0.44477,0.4456,0.44644,0.44727,0.4481,0.44894,0.44977,0.4506,0.45144,0.45227,0.45311,0.45394,0.45477,0.45561,0.45644,0.45727,0.45811,0.45894,0.45977,0.46061,0.46144,0.46228,0.46311,0.46394,0.46478,0.46561,0.46644,0.46728,0.46811,0.46895,0.46978,0.47061,0.47145,0.47228,0.47311,0.47395,0.47478,0.47561,0.47645,0.47728,0.47812,0.47895,0.47978,0.48062,0.48145,0.48228,0.48312,0.48395,0.48479,0.48562,0.48645,0.48729,0.48812,0.48895,0.48979,0.49062,0.49145,0.49229,0.49312,0.49396,0.49479,0.49562,0.49646,0.49729,0.49812,0.49896,0.49979,0.50063,0.50146,0.50229,0.50313,0.50396,0.50479,0.50563,0.50646,0.50729,0.50813,0.50896,0.5098,0.51063,0.51146,0.5123,0.51313,0.51396,0.5148,0.51563,0.51647,0.5173,0.51813,0.51897,0.5198,0.52063,0.52147,0.5223,0.52313,0.52397,0.5248,0.52564,0.52647,0.5273,0.52814,0.52897,0.5298,0.53064,0.53147,0.53231,0.53314,0.53397,0.53481,0.53564,0.53647,0.53731,0.53814,0.53897,0.53981,0.54064,0.54148,0.54231,0.54314,0.54398,0.54481,0.54564,0.54648,0.54731,0.54815,0.54898,0.54981,0.55065,0.55148,0.55231,0.55315,0.55398,0.55481,0.55565,0.55648,0.55732,0.55815,0.55898,0.55982,0.56065,0.56148,0.56232,0.56315,0.56398,0.56482,0.56565,0.56649,0.56732,0.56815,0.56899,0.56982,0.57065,0.57149,0.57232,0.57316,0.57399,0.57482,0.57566,0.57649,0.57732,0.57816,0.57899,0.57982,0.58066,0.58149,0.58233,0.58316,0.58399,0.58483,0.58566,0.58649,0.58733,0.58816,0.589,0.58983,0.59066,0.5915,0.59233,0.59316,0.594,0.59483,0.59566,0.5965,0.59733,0.59817,0.599,0.59983,0.60067,0.6015,0.60233,0.60317,0.604,0.60484,0.60567,0.6065,0.60734,0.60817,0.609,0.60984,0.61067,0.6115,0.61234,0.61317,0.61401,0.61484,0.61567,0.61651,0.61734,0.61817,0.61901,0.61984,0.62068,0.62151,0.62234,0.62318,0.62401,0.62484,0.62568,0.62651,0.62734,0.62818,0.62901,0.62985,0.63068,0.63151,0.63235,0.63318,0.63401,0.63485,0.63568,0.63652,0.63735,0.63818,0.63902,0.63985,0.64068,0.64152,0.64235,0.64318,0.64402,0.64485,0.64569,0.64652,0.64735,0.64819,0.64902,0.64985,0.65069,0.65152,0.65236,0.65319,0.65402,0.65486,0.65569,0.65652,0.65736,0.65819,0.65902,0.65986,0.66069,0.66153,0.66236,0.66319,0.66403,0.66486,0.66569,0.66653,0.66736,0.6682,0.66903,0.66986,0.6707,0.67153,0.67236,0.6732,0.67403,0.67486,0.6757,0.67653,0.67737,0.6782,0.67903,0.67987,0.6807,0.68153,0.68237,0.6832,0.68404,0.68487,0.6857,0.68654,0.68737,0.6882,0.68904,0.68987,0.6907,0.69154,0.69237,0.69321,0.69404,0.69487,0.69571,0.69654,0.69737,0.69821,0.69904,0.69987,0.70071,0.70154,0.70238,0.70321,0.70404,0.70488,0.70571,0.70654,0.70738,0.70821,0.70905,0.70988,0.71071,0.71155,0.71238,0.71321,0.71405,0.71488,0.71571,0.71655,0.71738,0.71822,0.71905,0.71988,0.72072,0.72155,0.72238,0.72322,0.72405,0.72489,0.72572,0.72655,0.72739,0.72822,0.72905,0.72989,0.73072,0.73155,0.73239,0.73322,0.73406,0.73489,0.73572,0.73656,0.73739,0.73822,0.73906,0.73989,0.74073,0.74156,0.74239,0.74323,0.74406,0.74489,0.74573,0.74656,0.74739,0.74823,0.74906,0.7499,0.75073,0.75156,0.7524,0.75323,0.75406,0.7549,0.75573,0.75657,0.7574,0.75823,0.75907,0.7599,0.76073,0.76157,0.7624,0.76323,0.76407,0.7649,0.76574,0.76657,0.7674,0.76824,0.76907,0.7699,0.77074,0.77157,0.77241,0.77324,0.77407,0.77491,0.77574,0.77657,0.77741,0.77824,0.77907,0.77991,0.78074,0.78158,0.78241,0.78324,0.78408,0.78491,0.78574,0.78658,0.78741,0.78825,0.78908,0.78991,0.79075,0.79158,0.79241,0.79325,0.79408,0.79491,0.79575,0.79658,0.79742,0.79825,0.79908,0.79992,0.80075,0.80158,0.80242,0.80325,0.80409,0.80492,0.80575,0.80659,0.80742,0.80825,0.80909,0.80992,0.81075,0.81159,0.81242,0.81326,0.81409,0.81492,0.81576,0.81659,0.81742,0.81826,0.81909,0.81992,0.82076,0.82159,0.82243,0.82326,0.82409,0.82493,0.82576,0.82659,0.82743,0.82826,0.8291,0.82993,0.83076,0.8316,0.83243,0.83326,0.8341,0.83493,0.83576,0.8366,0.83743,0.83827,0.8391,0.83993,0.84077,0.8416,0.84243,0.84327,0.8441,0.84494,0.84577,0.8466,0.84744,0.84827,0.8491,0.84994,0.85077,0.8516,0.85244,0.85327,0.85411,0.85494,0.85577,0.85661,0.85744,0.85827,0.85911,0.85994,0.86078,0.86161,0.86244,0.86328,0.86411,0.86494,0.86578,0.86661,0.86744,0.86828,0.86911,0.86995,0.87078,0.87161,0.87245,0.87328,0.87411,0.87495,0.87578,0.87662,0.87745,0.87828,0.87912,0.87995,0.88078,0.88162,0.88245,0.88328,0.88412,0.88495,0.88579,0.88662,0.88745,0.88829,0.88912,0.88995,0.89079,0.89162,0.89246,0.89329,0.89412,0.89496,0.89579,0.89662,0.89746,0.89829,0.89912,0.89996,0.90079,0.90163,0.90246,0.90329,0.90413,0.90496,0.90579,0.90663,0.90746,0.9083,0.90913,0.90996,0.9108,0.91163,0.91246,0.9133,0.91413,0.91496,0.9158,0.91663,0.91747,0.9183,0.91913,0.91997,0.9208,0.92163,0.92247,0.9233,0.92414,0.92497,0.9258,0.92664,0.92747,0.9283,0.92914,0.92997,0.9308,0.93164,0.93247,0.93331,0.93414,0.93497,0.93581,0.93664,0.93747,0.93831,0.93914,0.93997,0.94081,0.94164,0.94248,0.94331,0.94414,0.94498,0.94581,0.94664,0.94748,0.94831,0.94915,0.94998,0.95081,0.95165,0.95248,0.95331,0.95415,0.95498,0.95581,0.95665,0.95748,0.95832,0.95915,0.95998,0.96082,0.96165,0.96248,0.96332,0.96415,0.96499,0.96582,0.96665,0.96749,0.96832,0.96915,0.96999,0.97082,0.97165,0.97249,0.97332,0.97416,0.97499,0.97582,0.97666,0.97749,0.97832,0.97916,0.97999,0.98083,0.98166,0.98249,0.98333,0.98416,0.98499,0.98583,0.98666,0.98749,0.98833,0.98916,0.99,0.99083,0.99166,0.9925,0.99333,0.99416,0.995,0.99583,0.99667,0.9975,0.99833,0.99917,-1};
 
 
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////
+// Filename: stft.c
+//
+// Synopsis: Sliding-window analysis stage. Incoming samples are
+//   copied into a circular history of the last FFT_LENGTH
+//   samples per channel, still as Int16. Every ANALYSIS_HOP
+//   samples the history is converted and windowed into the FFT
+//   buffer in one pass and classified,
+//   independent of the EDMA frame length. All state lives in an
+//   stft_t and the arena it was given, so any number of streams
+//   can be analysed at once.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <math.h>
+#include "config.h"
+#include "fft.h"
+#include "peaks.h"
+#include "arena.h"
+#include "gate.h"
+#include "window.h"
+#include "stft.h"
+#include "placement.h"
+
+#if (FFT_LENGTH & (FFT_LENGTH - 1)) != 0
+#error FFT_LENGTH must be a power of two
+#endif
+
+#if ANALYSIS_HOP > FFT_LENGTH
+#error ANALYSIS_HOP must not exceed FFT_LENGTH
+#endif
+
+PLACE_INIT_CODE(stft_alloc)
+int stft_alloc(stft_t *stft, arena_t *arena)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Gives an instance its buffers
+//
+// Input:     stft - instance to set up
+//            arena - at least STFT_ARENA_BYTES free
+//
+// Returns:   0 on success, -1 if the arena ran out
+//
+// Calls:     arena_alloc, init_window
+//
+// Notes:     Call once, before init_stft. The window depends only on
+//            FFT_LENGTH, so it is filled in here and kept.
+///////////////////////////////////////////////////////////////////////
+{
+  stft->input = arena_alloc(arena, FFT_LENGTH * sizeof(COMPLEX));
+  stft->magnitude = arena_alloc(arena, NUM_DECODE_CHANNELS * (FFT_LENGTH/2 + 1) * sizeof(float));
+  stft->history = arena_alloc(arena, NUM_DECODE_CHANNELS * FFT_LENGTH * sizeof(int16_t));
+  stft->window = arena_alloc(arena, FFT_LENGTH * sizeof(float));
+
+  if(!stft->input || !stft->magnitude || !stft->history || !stft->window)
+    return -1;
+
+  init_window(stft->window, FFT_LENGTH);
+  return 0;
+}
+
+void init_stft(stft_t *stft, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Clear the history and set up the rate-dependent state
+//
+// Input:     stft - instance to initialize
+//            sample_rate - sample rate of the analysed stream in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     init_gate
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  int i, c;
+
+  for(i = 0; i < FFT_LENGTH; i++)
+    for(c = 0; c < NUM_DECODE_CHANNELS; c++)
+      stft->history[c][i] = 0;
+
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+    stft->peaks[c].num_peaks = 0;
+    init_gate(&stft->gate[c], sample_rate);
+  }
+  stft->gated = 0;
+
+  stft->bin_hz = sample_rate / NUM_FFT_SAMPLES;
+  stft->history_index = 0;
+  stft->hop_fill = 0;
+}
+
+PLACE_RT_CODE(stft_write)
+int stft_write(stft_t *stft, const int16_t *pBuf, int num_samples)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Copy interleaved L/R samples into the history
+//
+// Input:     stft - instance to feed
+//            pBuf - interleaved samples as delivered by the EDMA
+//            num_samples - number of L/R sample pairs available
+//
+// Returns:   Number of sample pairs consumed
+//
+// Calls:     Nothing
+//
+// Notes:     Stops early when a hop completes, so the caller can run
+//            stft_analyze before the history moves on. Adds up the
+//            gate's energy and zero crossings on the way, in locals
+//            so they stay in registers.
+///////////////////////////////////////////////////////////////////////
+{
+  int i, c, n = ANALYSIS_HOP - stft->hop_fill;
+  uint16_t j = stft->history_index;
+  float energy[NUM_DECODE_CHANNELS];
+  uint16_t crossings[NUM_DECODE_CHANNELS];
+  int16_t x, last[NUM_DECODE_CHANNELS];
+
+  if(n > num_samples)
+    n = num_samples;
+
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+    energy[c] = stft->gate[c].energy;
+    crossings[c] = stft->gate[c].crossings;
+    last[c] = stft->gate[c].last;
+  }
+
+  for(i = 0; i < n; i++) {
+    x = pBuf[0];
+    stft->history[0][j] = x;
+    energy[0] += (float)x * x;
+    crossings[0] += (x ^ last[0]) < 0;
+    last[0] = x;
+#ifdef DUAL_CHANNEL
+    x = pBuf[1];
+    stft->history[1][j] = x;
+    energy[1] += (float)x * x;
+    crossings[1] += (x ^ last[1]) < 0;
+    last[1] = x;
+#endif
+    j = (j + 1) & (FFT_LENGTH - 1);
+    pBuf += 2;
+  }
+
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+    stft->gate[c].energy = energy[c];
+    stft->gate[c].crossings = crossings[c];
+    stft->gate[c].last = last[c];
+  }
+
+  stft->history_index = j;
+  stft->hop_fill += n;
+  return n;
+}
+
+const float *stft_magnitude(const stft_t *stft, int channel)
+{
+  return stft->magnitude[channel];
+}
+
+PLACE_RT_CODE(stft_hop_ready)
+int stft_hop_ready(const stft_t *stft)
+{
+  return stft->hop_fill == ANALYSIS_HOP;
+}
+
+PLACE_RT_CODE(stft_analyze)
+void stft_analyze(stft_t *stft, COMPLEX *twiddle_factors, char *detected)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Windowed FFT and classification of the last FFT_LENGTH
+//            samples
+//
+// Input:     stft - instance to analyse
+//            twiddle_factors - FFT_LENGTH twiddle factors
+//            detected - one character per decode channel, updated
+//
+// Returns:   Nothing
+//
+// Calls:     gate_hop, fft_c, fft_split_real, classify_spectrum
+//
+// Notes:     The oldest sample sits at history_index. When the gate
+//            is closed on every channel the FFT is skipped and no
+//            digit is reported; the spectra are cleared once, so the
+//            telemetry does not repeat a stale one.
+///////////////////////////////////////////////////////////////////////
+{
+  int i, c;
+  uint16_t j = stft->history_index;
+  COMPLEX *input = stft->input;
+#ifndef DUAL_CHANNEL
+  float real_component, imag_component;
+#endif
+#if GATE_ENABLE
+  int open = 0;
+#endif
+
+  stft->hop_fill = 0;
+  stft->hops++;
+
+#if GATE_ENABLE
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++)
+    open |= gate_hop(&stft->gate[c]);
+
+  if(!open) {
+    stft->hops_gated++;
+    for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+      detected[c] = '\0';
+      stft->peaks[c].num_peaks = 0;
+      if(!stft->gated)
+	for(i = 0; i <= FFT_LENGTH/2; i++)
+	  stft->magnitude[c][i] = 0.0f;
+    }
+    stft->gated = 1;
+    return;
+  }
+  stft->gated = 0;
+#endif
+
+  // Unroll the circular history into the FFT buffer, converted and
+  // windowed in the same multiply
+  for(i = 0; i < FFT_LENGTH; i++) {
+    input[i].re = stft->window[i] * stft->history[0][j];
+#ifdef DUAL_CHANNEL
+    input[i].im = stft->window[i] * stft->history[1][j];
+#else
+    input[i].im = 0.0;
+#endif
+    j = (j + 1) & (FFT_LENGTH - 1);
+  }
+
+  fft_c(FFT_LENGTH, input, twiddle_factors);
+
+#ifdef DUAL_CHANNEL
+  // Separate the left and right spectra
+  fft_split_real(FFT_LENGTH, input, stft->magnitude[0], stft->magnitude[1]);
+#else
+  // Calculate magnitudes of FFT
+  for(i = 0; i <= FFT_LENGTH/2; i++) {
+    real_component = input[i].re * input[i].re;
+    imag_component = input[i].im * input[i].im;
+    stft->magnitude[0][i] = pow( real_component + imag_component, 0.5);
+  }
+#endif
+
+  // Peak finding and classification, independently per channel
+  for(c = 0; c < NUM_DECODE_CHANNELS; c++) {
+    detected[c] = classify_spectrum(stft->magnitude[c], FFT_LENGTH/2,
+				    stft->bin_hz, &stft->peaks[c]);
+#if GATE_ENABLE
+    // The other channel opened the FFT; this one stays silent
+    if(!stft->gate[c].open)
+      detected[c] = '\0';
+#endif
+  }
+}
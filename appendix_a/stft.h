@@ -0,0 +1,41 @@
+#ifndef STFT_H_INCLUDED
+#define STFT_H_INCLUDED
+
+#include <stdint.h>
+#include "config.h"
+#include "fft.h"
+#include "peaks.h"
+#include "arena.h"
+#include "gate.h"
+
+// One instance of the analysis stage. The window, history and FFT
+// scratch come from an arena (stft_alloc); the rest is held inline.
+typedef struct {
+  COMPLEX *input;			// left (.re), right (.im) in DUAL_CHANNEL
+  float (*magnitude)[FFT_LENGTH/2 + 1];	// [NUM_DECODE_CHANNELS]
+  int16_t (*history)[FFT_LENGTH];	// [NUM_DECODE_CHANNELS], as received
+  float *window;				// ANALYSIS_WINDOW, filled by stft_alloc
+  float bin_hz;				// width of one FFT bin at the current rate
+  uint16_t history_index;		// next sample to be written
+  uint16_t hop_fill;			// samples received since the last analysis
+  peak_state_t peaks[NUM_DECODE_CHANNELS];
+  gate_t gate[NUM_DECODE_CHANNELS];
+  uint8_t gated;			// the last hop skipped the FFT
+  uint32_t hops;			// analysis hops since reset
+  uint32_t hops_gated;			// of which skipped the FFT
+} stft_t;
+
+#define STFT_ARENA_BYTES \
+	(ARENA_BYTES(FFT_LENGTH * sizeof(COMPLEX)) + \
+	 ARENA_BYTES(NUM_DECODE_CHANNELS * (FFT_LENGTH/2 + 1) * sizeof(float)) + \
+	 ARENA_BYTES(NUM_DECODE_CHANNELS * FFT_LENGTH * sizeof(int16_t)) + \
+	 ARENA_BYTES(FFT_LENGTH * sizeof(float)))
+
+int stft_alloc(stft_t *stft, arena_t *arena);
+void init_stft(stft_t *stft, float sample_rate);
+int stft_write(stft_t *stft, const int16_t *pBuf, int num_samples);
+int stft_hop_ready(const stft_t *stft);
+void stft_analyze(stft_t *stft, COMPLEX *twiddle_factors, char *detected);
+const float *stft_magnitude(const stft_t *stft, int channel);
+
+#endif
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////
+// Filename: telemetry.c
+//
+// Synopsis: Compact binary frames for sending decoder state off
+//   the board (see telemetry.h for the layout). Builds frames in
+//   memory only; the caller decides where they go, so the same
+//   code is used by host tools.
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <math.h>
+#include "telemetry.h"
+
+static uint8_t sequence = 0;
+
+static uint8_t *put_u16(uint8_t *p, uint16_t value)
+{
+  p[0] = value & 0xFF;
+  p[1] = value >> 8;
+  return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t value)
+{
+  p[0] = value & 0xFF;
+  p[1] = (value >> 8) & 0xFF;
+  p[2] = (value >> 16) & 0xFF;
+  p[3] = value >> 24;
+  return p + 4;
+}
+
+uint16_t telemetry_crc16(const uint8_t *data, uint32_t len)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   CRC-16/CCITT over a block of bytes
+//
+// Input:     data - bytes to check, len - number of bytes
+//
+// Returns:   CRC value
+//
+// Calls:     Nothing
+//
+// Notes:     Bitwise; frames are short and sent at most a few
+//            hundred times per second
+///////////////////////////////////////////////////////////////////////
+{
+  uint16_t crc = 0xFFFF;
+  int bit;
+
+  while(len--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for(bit = 0; bit < 8; bit++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+
+  return crc;
+}
+
+uint8_t telemetry_log8(float magnitude)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Compresses a magnitude to 8 bits on a log scale
+//
+// Input:     magnitude - non-negative value
+//
+// Returns:   8*log2(1 + magnitude), clamped to 0..255 (0.75 dB steps)
+//
+// Calls:     frexp
+//
+// Notes:     log2 of the mantissa is approximated linearly (error
+//            below one code), which avoids a log call per bin
+///////////////////////////////////////////////////////////////////////
+{
+  int exponent;
+  float mantissa = (float) frexp(1.0f + magnitude, &exponent);	// 0.5 <= mantissa < 1
+  float code = 8.0f * (exponent - 1 + 2.0f * (mantissa - 0.5f));
+
+  if(code >= 255.0f)
+    return 255;
+  return (uint8_t)(code + 0.5f);
+}
+
+int telemetry_frame(uint8_t *frame, uint8_t type, const uint8_t *payload, uint16_t len)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Wraps a payload in sync, header and CRC
+//
+// Input:     frame - at least len + TELEM_OVERHEAD bytes
+//            type - TELEM_TYPE_*
+//            payload - packed payload, len - its length
+//
+// Returns:   Total frame length in bytes
+//
+// Calls:     telemetry_crc16
+//
+// Notes:     payload may already sit at frame + TELEM_HEADER_BYTES
+///////////////////////////////////////////////////////////////////////
+{
+  uint8_t *p = frame;
+  uint16_t i;
+
+  *p++ = TELEM_SYNC0;
+  *p++ = TELEM_SYNC1;
+  *p++ = type;
+  *p++ = sequence++;
+  p = put_u16(p, len);
+
+  if(payload != p)
+    for(i = 0; i < len; i++)
+      p[i] = payload[i];
+  p += len;
+
+  p = put_u16(p, telemetry_crc16(frame + 2, TELEM_HEADER_BYTES - 2 + len));
+  return p - frame;
+}
+
+int telemetry_pack_digit(uint8_t *payload, const digit_event_t *event)
+{
+  uint8_t *p = payload;
+
+  *p++ = event->channel;
+  *p++ = event->digit;
+  *p++ = event->confidence;
+  *p++ = 0;
+  p = put_u32(p, event->start_sample);
+  p = put_u32(p, event->end_sample);
+  return p - payload;
+}
+
+int telemetry_pack_peaks(uint8_t *payload, uint32_t sample, uint8_t channel, const peak_state_t *peaks)
+{
+  uint8_t *p = payload;
+  int i;
+
+  p = put_u32(p, sample);
+  *p++ = channel;
+  *p++ = NUM_REPORTED_PEAKS;
+  for(i = 0; i < NUM_REPORTED_PEAKS; i++) {
+    if(i < peaks->num_peaks) {
+      p = put_u16(p, (uint16_t)(peaks->bin[i] * 256.0f + 0.5f));
+      *p++ = telemetry_log8(peaks->magnitude[i]);
+    }
+    else {
+      p = put_u16(p, 0);	// no peak
+      *p++ = 0;
+    }
+  }
+  return p - payload;
+}
+
+int telemetry_pack_spectrum(uint8_t *payload, uint32_t sample, uint8_t channel,
+			    const float *magnitude, uint16_t bins)
+{
+  uint8_t *p = payload;
+  uint16_t i;
+
+  p = put_u32(p, sample);
+  *p++ = channel;
+  *p++ = TELEM_SPECTRUM_LOG8;
+  p = put_u16(p, bins);
+  for(i = 0; i < bins; i++)
+    *p++ = telemetry_log8(magnitude[i]);
+  return p - payload;
+}
+
+int telemetry_pack_stats(uint8_t *payload, const telemetry_stats_t *stats)
+{
+  uint8_t *p = payload;
+
+  p = put_u32(p, stats->sample_rate);
+  p = put_u16(p, stats->fft_length);
+  p = put_u16(p, stats->hop);
+  *p++ = stats->channels;
+  *p++ = stats->detector;
+  *p++ = stats->load_sweep;
+  *p++ = 0;
+  p = put_u32(p, stats->sample_clock);
+  p = put_u32(p, stats->frames);
+  p = put_u32(p, stats->hop_cycles_last);
+  p = put_u32(p, stats->hop_cycles_max);
+  p = put_u32(p, stats->over_runs);
+  p = put_u32(p, stats->uart_overflows);
+  p = put_u32(p, stats->events_dropped);
+  p = put_u32(p, stats->frame_period);
+  p = put_u32(p, stats->frame_cycles_max);
+  p = put_u32(p, stats->render_cycles_max);
+  p = put_u32(p, stats->cache_off_cycles);
+  p = put_u32(p, stats->cache_on_cycles);
+  *p++ = stats->load_percent;
+  *p++ = stats->peak_load_percent;
+  p = put_u16(p, stats->average_load);
+  p = put_u32(p, stats->load_cycles);
+  p = put_u32(p, stats->load_sustained);
+  p = put_u32(p, stats->hops);
+  p = put_u32(p, stats->hops_gated);
+  return p - payload;
+}
+
+int telemetry_pack_deadline(uint8_t *payload, uint32_t sample, const deadline_t *dl)
+{
+  uint8_t *p = payload;
+  int i;
+
+  p = put_u32(p, sample);
+  p = put_u32(p, dl->period);
+  p = put_u32(p, dl->frames);
+  p = put_u32(p, dl->late);
+  p = put_u32(p, dl->over_runs);
+  p = put_u32(p, dl->longest_run);
+  p = put_u32(p, (uint32_t)dl->min_headroom);
+  p = put_u32(p, dl->worst.frame);
+  p = put_u32(p, dl->worst.duration);
+  for(i = 0; i < DEADLINE_ZONES; i++)
+    p = put_u32(p, dl->worst.zone[i]);
+  for(i = 0; i < DEADLINE_BINS; i++)
+    p = put_u32(p, dl->histogram[i]);
+  return p - payload;
+}
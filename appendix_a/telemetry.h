@@ -0,0 +1,78 @@
+#ifndef TELEMETRY_H_INCLUDED
+#define TELEMETRY_H_INCLUDED
+
+#include <stdint.h>
+#include "events.h"
+#include "peaks.h"
+#include "deadline.h"
+
+// Frame layout (multi-byte fields little endian):
+//   0  sync      TELEM_SYNC0, TELEM_SYNC1
+//   2  type      TELEM_TYPE_*
+//   3  sequence  increments per frame, wraps
+//   4  length    payload bytes (uint16)
+//   6  payload
+//   6+length     CRC-16/CCITT (poly 0x1021, init 0xFFFF) of bytes 2..5+length
+#define TELEM_SYNC0		0xA5
+#define TELEM_SYNC1		0x5A
+#define TELEM_HEADER_BYTES	6
+#define TELEM_OVERHEAD		(TELEM_HEADER_BYTES + 2)
+
+#define TELEM_TYPE_DIGIT	1	// one digit_event_t
+#define TELEM_TYPE_SPECTRUM	2	// magnitude spectrum of one channel
+#define TELEM_TYPE_PEAKS	3	// peak list of one channel
+#define TELEM_TYPE_STATS	4	// configuration and counters
+#define TELEM_TYPE_DEADLINE	5	// frame deadline histogram and slowest frame
+
+// Spectrum encodings
+#define TELEM_SPECTRUM_LOG8	0	// code = 8*log2(1 + |X|), clamped to 255
+
+// Payload sizes
+#define TELEM_DIGIT_BYTES	12	// channel, digit, confidence, pad, start, end
+#define TELEM_PEAKS_BYTES	(6 + 3*NUM_REPORTED_PEAKS)	// sample, channel, count, {bin Q8.8, level}
+#define TELEM_SPECTRUM_BYTES(bins) (8 + (bins))	// sample, channel, encoding, count, codes
+#define TELEM_STATS_BYTES	80
+#define TELEM_DEADLINE_BYTES	(36 + 4*DEADLINE_ZONES + 4*DEADLINE_BINS)	// sample, counters, worst, histogram
+
+#define TELEM_MAX_PAYLOAD	1024
+
+typedef struct {
+  uint32_t sample_rate;
+  uint16_t fft_length;
+  uint16_t hop;
+  uint8_t channels;
+  uint8_t detector;		// DETECTOR_STFT or DETECTOR_SDFT
+  uint8_t load_sweep;		// LOAD_SWEEP_* state of the synthetic load
+  uint32_t sample_clock;	// first sample of the current frame
+  uint32_t frames;		// EDMA frames processed
+  uint32_t hop_cycles_last;
+  uint32_t hop_cycles_max;
+  uint32_t over_runs;		// frames that were not processed in time
+  uint32_t uart_overflows;	// telemetry refused by the UART ring
+  uint32_t events_dropped;	// digits lost to a full event ring
+  uint32_t frame_period;	// cycles between EDMA frames
+  uint32_t frame_cycles_max;	// worst ProcessBuffer, must stay below frame_period
+  uint32_t render_cycles_max;	// worst tone rendering (loopback build)
+  uint32_t cache_off_cycles;	// average ProcessBuffer at boot, caches off
+  uint32_t cache_on_cycles;	// the same with the caches on
+  uint8_t load_percent;		// busy share of the last frame, from idle time
+  uint8_t peak_load_percent;	// highest load_percent since start-up
+  uint16_t average_load;	// busy share since start-up, per mille
+  uint32_t load_cycles;		// synthetic load burnt in the last frame
+  uint32_t load_sustained;	// highest load a sweep step ran without an over_run
+  uint32_t hops;		// analysis hops since reset
+  uint32_t hops_gated;		// of which the energy gate skipped the FFT
+} telemetry_stats_t;
+
+uint16_t telemetry_crc16(const uint8_t *data, uint32_t len);
+uint8_t telemetry_log8(float magnitude);
+
+int telemetry_frame(uint8_t *frame, uint8_t type, const uint8_t *payload, uint16_t len);
+int telemetry_pack_digit(uint8_t *payload, const digit_event_t *event);
+int telemetry_pack_peaks(uint8_t *payload, uint32_t sample, uint8_t channel, const peak_state_t *peaks);
+int telemetry_pack_spectrum(uint8_t *payload, uint32_t sample, uint8_t channel,
+			    const float *magnitude, uint16_t bins);
+int telemetry_pack_stats(uint8_t *payload, const telemetry_stats_t *stats);
+int telemetry_pack_deadline(uint8_t *payload, uint32_t sample, const deadline_t *dl);
+
+#endif
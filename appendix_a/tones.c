@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////
+// Filename: tones.c
+//
+// Synopsis: Block DTFM tone renderer for the loopback build.
+//   Dials LOOPBACK_PATTERN over and over, writing whole EDMA
+//   frames at a time into the transmit buffer. Tones come from
+//   the same half-cycle tables as the sample-by-sample encoder
+//   (waveforms.c).
+//
+////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include "config.h"
+#include "dtfm.h"
+#include "waveforms.h"
+#include "tones.h"
+#include "placement.h"
+
+static const char pattern[] = LOOPBACK_PATTERN;
+static const char keypad[] = "123A456B789C*0#D";
+
+static float tone_steps[DTFM_NUM_TONES];	// LUT indices per sample
+static uint32_t on_samples, off_samples;
+
+static uint16_t pattern_index = 0;
+static uint8_t low_tone, high_tone;		// tones of the digit being dialled
+static uint8_t tone_on = 0;
+static uint32_t remaining = 0;			// samples left in this tone or gap
+static float low_index = 0.0, high_index = 0.0;
+
+void tones_set_rate(float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Recomputes step sizes and durations for a sample rate
+//
+// Input:     sample_rate - rate of the transmit path in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Keeps the running indices, so a tone in progress carries
+//            on with the same phase
+///////////////////////////////////////////////////////////////////////
+{
+  int i;
+
+  for(i = 0; i < DTFM_NUM_TONES; i++)
+    tone_steps[i] = dtfm_tone_freqs[i] * MAX_WAVEFORM_INDEX / sample_rate;
+
+  on_samples = (uint32_t)(TONE_ON_MS * sample_rate / 1000);
+  off_samples = (uint32_t)(TONE_OFF_MS * sample_rate / 1000);
+  if(remaining > on_samples)
+    remaining = on_samples;
+}
+
+PLACE_INIT_CODE(init_tones)
+void init_tones(float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Restarts the pattern with a gap
+//
+// Input:     sample_rate - rate of the transmit path in Hz
+//
+// Returns:   Nothing
+//
+// Calls:     tones_set_rate
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+  pattern_index = 0;
+  tone_on = 0;
+  remaining = 0;
+  low_index = 0.0;
+  high_index = 0.0;
+
+  tones_set_rate(sample_rate);
+  remaining = off_samples;
+}
+
+PLACE_RT_CODE(next_digit)
+static void next_digit(void)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Looks up the tone pair of the next pattern digit
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Characters that are not on the keypad are sent as gaps
+///////////////////////////////////////////////////////////////////////
+{
+  char digit = pattern[pattern_index];
+  int key;
+
+  if(++pattern_index >= sizeof(pattern) - 1)
+    pattern_index = 0;
+
+  for(key = 0; keypad[key] != '\0' && keypad[key] != digit; key++)
+    ;
+
+  tone_on = keypad[key] != '\0';
+  low_tone = key / DTFM_NUM_COLS;
+  high_tone = DTFM_NUM_ROWS + key % DTFM_NUM_COLS;
+}
+
+PLACE_RT_CODE(tones_render)
+void tones_render(int16_t *pBuf, int num_samples)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Fills a block of interleaved L/R samples with the pattern
+//
+// Input:     pBuf - interleaved samples, overwritten
+//            num_samples - number of L/R sample pairs
+//
+// Returns:   Nothing
+//
+// Calls:     sine_wave, next_digit
+//
+// Notes:     Both channels carry the same signal
+///////////////////////////////////////////////////////////////////////
+{
+  float output_signal;
+  int n;
+
+  for(n = 0; n < num_samples; n++) {
+    if(remaining == 0) {
+      if(tone_on) {
+	tone_on = 0;
+	remaining = off_samples;
+      }
+      else {
+	next_digit();
+	remaining = tone_on ? on_samples : off_samples;
+      }
+    }
+    remaining--;
+
+    output_signal = 0.0;
+    if(tone_on) {
+      output_signal = sine_wave(low_index) + sine_wave(high_index);
+
+      low_index += tone_steps[low_tone];
+      if(low_index >= MAX_WAVEFORM_INDEX)
+	low_index -= MAX_WAVEFORM_INDEX;
+      high_index += tone_steps[high_tone];
+      if(high_index >= MAX_WAVEFORM_INDEX)
+	high_index -= MAX_WAVEFORM_INDEX;
+    }
+
+    pBuf[2*n] = (int16_t)(output_signal * TONE_AMPLITUDE);
+    pBuf[2*n + 1] = pBuf[2*n];
+  }
+}
@@ -0,0 +1,10 @@
+#ifndef TONES_H_INCLUDED
+#define TONES_H_INCLUDED
+
+#include <stdint.h>
+
+void init_tones(float sample_rate);
+void tones_set_rate(float sample_rate);
+void tones_render(int16_t *pBuf, int num_samples);
+
+#endif
@@ -11,7 +11,9 @@
 #include "config.h"
 #include "waveforms.h"
 #include "sine_wave.h"
+#include "placement.h"
 
+PLACE_RT_CODE(sine_wave)
 float sine_wave( float total_index )
 {
 	float lut_weighting_low = 0.0;
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////
+// Filename: window.c
+//
+// Synopsis: Analysis windows for the STFT detector. Each is a
+//   sum of cosines in its periodic form, so overlapping hops sum
+//   flat, and is scaled to the Hann window's coherent gain of
+//   one half. A tone then comes out of the FFT at the same
+//   magnitude whichever window is chosen, and the spectrum
+//   telemetry keeps its scale.
+//
+////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include "config.h"
+#include "fft.h"
+#include "window.h"
+#include "placement.h"
+
+#define WINDOW_TERMS	5
+
+// Cosine coefficients a0 - a1 cos + a2 cos 2x - ..., by ANALYSIS_WINDOW
+static const double window_terms[][WINDOW_TERMS] = {
+  { 0.5, 0.5, 0.0, 0.0, 0.0 },					// Hann
+  { 0.35875, 0.48829, 0.14128, 0.01168, 0.0 },			// Blackman-Harris, 4 term
+  { 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 }	// flat top
+};
+
+PLACE_INIT_CODE(init_window)
+void init_window(float *window, int length)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Fills in the ANALYSIS_WINDOW table
+//
+// Input:     window - room for length values
+//            length - FFT length the window is for
+//
+// Returns:   Nothing
+//
+// Calls:     cos
+//
+// Notes:     Depends only on the length, so a table is filled once and
+//            kept across rate changes
+///////////////////////////////////////////////////////////////////////
+{
+  const double *a = window_terms[ANALYSIS_WINDOW];
+  double w, scale = 0.5 / a[0];
+  int i, k;
+
+  for(i = 0; i < length; i++) {
+    w = a[0];
+    for(k = 1; k < WINDOW_TERMS; k++)
+      w += (k & 1 ? -a[k] : a[k]) * cos(2.0*MYPI*k*i/length);
+    window[i] = (float)(w * scale);
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef WINDOW_H_INCLUDED
+#define WINDOW_H_INCLUDED
+
+#include "config.h"
+
+// Bins either side of a tone's peak that its main lobe covers, and that
+// hold all but a few percent of its energy, for ANALYSIS_WINDOW
+#if ANALYSIS_WINDOW == WINDOW_BLACKMAN_HARRIS
+#define WINDOW_LOBE_BINS	4
+#define WINDOW_TONE_BINS	2
+#elif ANALYSIS_WINDOW == WINDOW_FLAT_TOP
+#define WINDOW_LOBE_BINS	5
+#define WINDOW_TONE_BINS	3
+#else
+#define WINDOW_LOBE_BINS	2
+#define WINDOW_TONE_BINS	1
+#endif
+
+void init_window(float *window, int length);
+
+#endif
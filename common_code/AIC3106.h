@@ -117,6 +117,9 @@
 #define AIC3106_REG0_RESERVED110			110
 #define AIC3106_REG0_RESERVED127			127
 
+#define AIC3106_NUM_PAGE0_REGS				128	// registers shadowed by the driver
+#define AIC3106_MAX_BURST					32	// longest auto-increment write
+
 // PAGE 1 registers
 #define AIC3106_REG1_PAGESELECT    			128
 
@@ -15,7 +15,7 @@
 #include "../appendix_a/config.h"
 // uncomment just the line for the sample rate when using the OMAP-L138
 
-#ifdef ENCODER
+#if defined(ENCODER) && !defined(DECODER)
 #define SampleRateSetting 		AIC3106Fs48kHz		// 48kHz sample rate
 #endif
 //#define SampleRateSetting 		AIC3106Fs96kHz		// 96kHz sample rate
@@ -23,9 +23,13 @@
 //#define SampleRateSetting 		AIC3106Fs24kHz		// 24kHz sample rate
 //#define SampleRateSetting 		AIC3106Fs16kHz		// 16kHz sample rate
 //#define SampleRateSetting 		AIC3106Fs12kHz		// 12kHz sample rate
-#ifdef DECODER
+#ifdef DECODER		// also the loopback build
+#if CODEC_FREQUENCY == 48000
+#define SampleRateSetting 		AIC3106Fs48kHz		// 48kHz, decimated to the decoder
+#else
 #define SampleRateSetting 		AIC3106Fs8kHz		//  8kHz sample rate
 #endif
+#endif
 
 
 #endif
@@ -11,6 +11,7 @@
 
 #include "DSP_Config.h"
 #include "AIC3106.h"
+#include "../appendix_a/placement.h"
 
 
 static float SampleFreq = 0.0F;
@@ -43,6 +44,7 @@ float GetSampleFreq()
 //
 // Notes:     SampleRateSetting is define in OMAPL138_Config.h
 ///////////////////////////////////////////////////////////////////////
+PLACE_INIT_CODE(DSP_Init)
 void DSP_Init()
 {
 	Init_Interrupts();
@@ -65,6 +67,7 @@ void DSP_Init()
 //
 // Notes:     SampleRateSetting is define in OMAPL138_Config.h
 ///////////////////////////////////////////////////////////////////////
+PLACE_INIT_CODE(DSP_Init_EDMA)
 void DSP_Init_EDMA()
 {
 	Init_Interrupts_EDMA();
@@ -76,8 +79,135 @@ void DSP_Init_EDMA()
 	EnableInterrupts_EDMA();
 }
 
+#define SDRAM_FIRST_MAR		192		// 0xC0000000
+#define SDRAM_NUM_MARS		8		// 128 MB of mDDR2
+
+PLACE_INIT_CODE(Init_Cache)
+void Init_Cache()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Turns on L1P, L1D and L2 cache and makes SDRAM cacheable
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     CACHE_L2_KB and CACHE_SDRAM are set in config.h. The L2
+//            cache is taken from the top of DSPRAM, which link6748.cmd
+//            must leave free. Each mode register is read back so the
+//            change has taken effect before returning.
+///////////////////////////////////////////////////////////////////////
+{
+	volatile Uint32 dummy;
+	Uint32 mode, kb, i;
+
+	CACHE_L1PCFG = CACHE_L1_MAX;
+	dummy = CACHE_L1PCFG;
+	CACHE_L1DCFG = CACHE_L1_MAX;
+	dummy = CACHE_L1DCFG;
+
+	// L2 mode n gives 16 KB << n of cache, mode 0 none
+	for(mode = 0, kb = CACHE_L2_KB; kb >= 32; kb >>= 1)
+		mode++;
+	CACHE_L2CFG = (CACHE_L2CFG & ~7) | mode;
+	dummy = CACHE_L2CFG;
+
+	for(i = 0;i < SDRAM_NUM_MARS;i++)
+		CACHE_MAR(SDRAM_FIRST_MAR + i) = CACHE_SDRAM ? CACHE_MAR_PC : 0;
+}
+
+PLACE_INIT_CODE(Disable_Cache)
+void Disable_Cache()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Turns every cache off, as after reset with L1 disabled
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Dirty lines are written back first. Only for measuring
+//            what the caches are worth; Init_Cache turns them on again.
+///////////////////////////////////////////////////////////////////////
+{
+	volatile Uint32 dummy;
+	Uint32 i;
+
+	CACHE_L2WBINV = 1;
+	while(CACHE_L2WBINV & 1)
+		;
+
+	for(i = 0;i < SDRAM_NUM_MARS;i++)
+		CACHE_MAR(SDRAM_FIRST_MAR + i) = 0;
+	CACHE_L2CFG &= ~7;
+	dummy = CACHE_L2CFG;
+	CACHE_L1DCFG = 0;
+	dummy = CACHE_L1DCFG;
+	CACHE_L1PCFG = 0;
+	dummy = CACHE_L1PCFG;
+}
+
+PLACE_RT_CODE(Cache_Block)
+static void Cache_Block(volatile Uint32 *bar, volatile Uint32 *wc, const void *addr, Uint32 num_bytes)
+{
+	Uint32 start = (Uint32)addr & ~(CACHE_LINE_BYTES - 1);
+	Uint32 words = ((Uint32)addr + num_bytes - start + 3) >> 2;
+	Uint32 n;
+
+	while(words) {
+		n = words < CACHE_BLOCK_MAX_WORDS ? words : CACHE_BLOCK_MAX_WORDS & ~(CACHE_LINE_BYTES/4 - 1);
+		*bar = start;
+		*wc = n;
+		while(*wc)
+			;
+		start += n << 2;
+		words -= n;
+	}
+}
+
+PLACE_RT_CODE(Cache_Invalidate)
+void Cache_Invalidate(const void *addr, Uint32 num_bytes)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Discards cached copies of a buffer the EDMA has written
+//
+// Input:     addr - start of the buffer
+//            num_bytes - length of the buffer
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Works on whole 128-byte lines, so the buffer must be line
+//            aligned or unsaved neighbours are lost. Waits until done.
+//            Covers L1D as well as L2.
+///////////////////////////////////////////////////////////////////////
+{
+	Cache_Block(&CACHE_L2IBAR, &CACHE_L2IWC, addr, num_bytes);
+}
+
+PLACE_RT_CODE(Cache_Writeback)
+void Cache_Writeback(const void *addr, Uint32 num_bytes)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Writes a buffer the EDMA is about to read out of the cache
+//
+// Input:     addr - start of the buffer
+//            num_bytes - length of the buffer
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Lines stay valid. Waits until done.
+///////////////////////////////////////////////////////////////////////
+{
+	Cache_Block(&CACHE_L2WBAR, &CACHE_L2WWC, addr, num_bytes);
+}
+
 #define GPIO_I2C_ADDR          0x21   
 
+PLACE_INIT_CODE(InitGpioExpander)
 Int32 InitGpioExpander()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Initializes GPIO expander to drive user LEDs  
@@ -163,6 +293,7 @@ Int32  ReadSwitches()
 #define DIGITAL_OUTPUT_MASK_3	0x00200000	// GP7[5]
 #define DIGITAL_OUTPUT_MASK_ALL	(DIGITAL_OUTPUT_MASK_0 | DIGITAL_OUTPUT_MASK_1 | DIGITAL_OUTPUT_MASK_2 | DIGITAL_OUTPUT_MASK_3)
 
+PLACE_INIT_CODE(InitDigitalOutputs)
 void InitDigitalOutputs()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Initializes digital output pins on board  
@@ -193,6 +324,7 @@ void InitDigitalOutputs()
 	GPIO_CLR_DATA67 = DIGITAL_OUTPUT_MASK_ALL;	// clear all pins to 0
 }
 
+PLACE_RT_CODE(WriteDigitalOutputs)
 void WriteDigitalOutputs(Uint8 data)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Writes to digital output pins on board  
@@ -231,6 +363,7 @@ void WriteDigitalOutputs(Uint8 data)
 		GPIO_CLR_DATA67 = DIGITAL_OUTPUT_MASK_3;
 }
 
+PLACE_INIT_CODE(Init_Interrupts)
 void Init_Interrupts()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Initializes interrupts  
@@ -251,6 +384,7 @@ void Init_Interrupts()
 	intc->intmux3 = 0x0F0E0D00 | 61; 	// assign McASP0 irq to INT12
 }
 
+PLACE_INIT_CODE(EnableInterrupts)
 void EnableInterrupts()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Enables McASP interrupt  
@@ -268,6 +402,7 @@ void EnableInterrupts()
   	ICR = 0xffff;       				// clear all pending interrupts
  	CSR |= 1;           				// set GIE
 }
+PLACE_INIT_CODE(Init_Interrupts_EDMA)
 void Init_Interrupts_EDMA()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Initializes interrupts for EDMA use 
@@ -286,6 +421,7 @@ void Init_Interrupts_EDMA()
 	// EDMA3_CC0_INT1 irq sent to INT8 by default
 }
 
+PLACE_INIT_CODE(EnableInterrupts_EDMA)
 void EnableInterrupts_EDMA()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Enables EDMA3_CC0_INT1 interrupt  
@@ -304,6 +440,7 @@ void EnableInterrupts_EDMA()
  	CSR |= 1;           				// set GIE
 }
 
+PLACE_INIT_CODE(wait)
 void wait(Uint32 delay)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Simple software delay loop  
@@ -326,6 +463,7 @@ void wait(Uint32 delay)
 
 #define I2C_timeout 	100000		// iteration limit for I2C 
 
+PLACE_INIT_CODE(Init_I2C)
 void Init_I2C()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Initializes I2C controller 
@@ -348,6 +486,7 @@ void Init_I2C()
     i2c->cmdr  |= ICCMDR_IRS;	// out of reset
 }
 
+PLACE_INIT_CODE(Reset_I2C)
 void Reset_I2C()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Resets I2C controller 
@@ -366,6 +505,7 @@ void Reset_I2C()
 }
 
 
+PLACE_INIT_CODE(Write_I2C)
 Uint32 Write_I2C(Uint16 addr, Uint8* pdata, Uint16 num_bytes)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Write to device on I2C link 
@@ -401,6 +541,7 @@ Uint32 Write_I2C(Uint16 addr, Uint8* pdata, Uint16 num_bytes)
 	return i;
 }
 
+PLACE_INIT_CODE(WriteRead_I2C)
 Uint32 WriteRead_I2C(Uint16 addr, Uint8* pdata, Uint16 w_bytes, Uint16 r_bytes)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Writes to device on I2C link, then does read without STOP
@@ -453,6 +594,7 @@ Uint32 WriteRead_I2C(Uint16 addr, Uint8* pdata, Uint16 w_bytes, Uint16 r_bytes)
 	return i;
 }
 
+PLACE_INIT_CODE(Read_I2C)
 Uint32 Read_I2C(Uint16 addr, Uint8* pdata, Uint16 num_bytes)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Read from device on I2C link 
@@ -489,6 +631,7 @@ Uint32 Read_I2C(Uint16 addr, Uint8* pdata, Uint16 num_bytes)
     return i;
 }
 
+PLACE_RT_CODE(ReadCodecData)
 Uint32 ReadCodecData()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Read McASP receive data
@@ -507,6 +650,7 @@ Uint32 ReadCodecData()
 	return port->rbuf[12];
 }
 
+PLACE_RT_CODE(WriteCodecData)
 void WriteCodecData(Uint32 data)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Write McASP transmit data
@@ -525,6 +669,7 @@ void WriteCodecData(Uint32 data)
 	port->xbuf[11] = data;
 }
 
+PLACE_RT_CODE(CheckForOverrun)
 Uint32 CheckForOverrun()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Check if a McASP overrun occurred and re-init McASP if so
@@ -548,6 +693,39 @@ Uint32 CheckForOverrun()
 }
 
 
+// AIC3106 configuration applied after reset and sample rate selection.
+// Entries are kept in ascending register order so that contiguous runs
+// are sent as single auto-increment bursts by AIC3106_write_table.
+static const AIC3106_REG_VALUE AIC3106_init_table[] = {
+	{AIC3106_REG0_CODEC_DATAPATH, 0x0A},		// l/r DACs set to l/r
+	{AIC3106_REG0_SERIAL_DATA_INTFC_A, 0xF0},	// codec is master
+	{AIC3106_REG0_SERIAL_DATA_INTFC_B, 0x40},	// DSP mode, 16-bit
+	{AIC3106_REG0_SERIAL_DATA_INTFC_C, 0x00},	// no offset
+	{AIC3106_REG0_LEFT_ADC_PGA, 0x00},			// gain=0db
+	{AIC3106_REG0_RIGHT_ADC_PGA, 0x00},			// gain=0db
+	{AIC3106_REG0_LINE1L_LEFT_ADC, 0x04},		// single-ended, 0db, powered-up
+	{AIC3106_REG0_LINE1R_RIGHT_ADC, 0x04},		// single-ended, 0db, powered-up
+	{AIC3106_REG0_LEFT_AGC_CNTL_A, 0x00},		// agc disabled
+	{AIC3106_REG0_RIGHT_AGC_CNTL_A, 0x00},		// agc disabled
+	{AIC3106_REG0_DAC_POWER_OUTPUT_DRVR, 0xE0},	// l/r DACs on, HPLCOM single-ended
+	{AIC3106_REG0_HI_POWER_OUTPUT_DRVR, 0x10},	// HPRCOM single-ended
+	{AIC3106_REG0_LEFT_DAC_VOLUME, 0x00},		// gain=0db
+	{AIC3106_REG0_RIGHT_DAC_VOLUME, 0x00},		// gain=0db
+	{AIC3106_REG0_DAC_L1_TO_HPLOUT, 0x80},		// DAC_L1 is routed to HPLOUT
+	{AIC3106_REG0_HPLOUT_OUTPUT_LEVEL, 0x09},	// HPLOUT on
+	{AIC3106_REG0_HPLCOM_OUTPUT_LEVEL, 0x00},	// 0db
+	{AIC3106_REG0_DAC_R1_TO_HPROUT, 0x80},		// DAC_R1 is routed to HPROUT
+	{AIC3106_REG0_HPROUT_OUTPUT_LEVEL, 0x09},	// HPROUT on
+	{AIC3106_REG0_HPRCOM_OUTPUT_LEVEL, 0x00},	// 0db
+	{AIC3106_REG0_DAC_L1_TO_LEFT_LOP, 0x80},	// DAC_L1 is routed to LEFT_LOP/M
+	{AIC3106_REG0_LEFT_LOP_OUTPUT_LEVEL, 0x09},	// 0db
+	{AIC3106_REG0_DAC_R1_TO_RIGHT_LOP, 0x80},	// DAC_R1 is routed to RIGHT_LOP/M
+	{AIC3106_REG0_RIGHT_LOP_OUTPUT_LEVEL, 0x09},// 0db
+	{AIC3106_REG0_ADDNL_GPIO_CONTROL_B, 0x01},	// CODEC_CLKIN uses CLKDIV_OUT
+	{AIC3106_REG0_CLOCK_GEN_CONTROL, 0x02}		// CLKDIV_IN/PLLCLK_IN uses MCLK, /2
+};
+
+PLACE_INIT_CODE(Init_AIC3106)
 Uint32 Init_AIC3106(Uint8 nFs)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Performs initialization of the OMAP-L138's onboard codec
@@ -556,7 +734,7 @@ Uint32 Init_AIC3106(Uint8 nFs)
 //
 // Returns:   Nothing
 //
-// Calls:     Reset_AIC3106, SetSampleRate_AIC3106, AIC3106_write_reg 
+// Calls:     Reset_AIC3106, SetSampleRate_AIC3106, AIC3106_write_table 
 //
 // Notes:     None
 ///////////////////////////////////////////////////////////////////////
@@ -565,63 +743,101 @@ Uint32 Init_AIC3106(Uint8 nFs)
    		return 0;
 	if(!SetSampleRate_AIC3106(nFs))
 		return 0;
-    if(!AIC3106_write_reg(AIC3106_REG0_CODEC_DATAPATH, 0x0A))  		// l/r DACs set to l/r
-		return 0;
-    if(!AIC3106_write_reg(AIC3106_REG0_SERIAL_DATA_INTFC_A, 0xF0))	// codec is master
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_SERIAL_DATA_INTFC_B, 0x40))	// DSP mode, 16-bit
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_SERIAL_DATA_INTFC_C, 0x00))	// no offset
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_LEFT_ADC_PGA, 0x00))			// gain=0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_RIGHT_ADC_PGA, 0x00))		// gain=0db 
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_LINE1L_LEFT_ADC, 0x04))		// single-ended, 0db, powered-up
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_LINE1R_RIGHT_ADC, 0x04))		// single-ended, 0db, powered-up 
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_LEFT_AGC_CNTL_A, 0x00))		// agc disabled
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_RIGHT_AGC_CNTL_A, 0x00))		// agc disabled
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_DAC_POWER_OUTPUT_DRVR, 0xE0))// l/r DACs on, HPLCOM single-ended
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_HI_POWER_OUTPUT_DRVR, 0x10))	// HPRCOM single-ended
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_LEFT_DAC_VOLUME, 0x00))		// gain=0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_RIGHT_DAC_VOLUME, 0x00))		// gain=0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_DAC_L1_TO_HPLOUT, 0x80))		// DAC_L1 is routed to HPLOUT
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_HPLOUT_OUTPUT_LEVEL, 0x09))	// HPLOUT on
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_HPLCOM_OUTPUT_LEVEL, 0x00))	// 0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_DAC_R1_TO_HPROUT, 0x80))		// DAC_R1 is routed to HPROUT
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_HPROUT_OUTPUT_LEVEL, 0x09))	// HPROUT on
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_HPRCOM_OUTPUT_LEVEL, 0x00))	// 0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_DAC_L1_TO_LEFT_LOP, 0x80))	// DAC_L1 is routed to LEFT_LOP/M
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_LEFT_LOP_OUTPUT_LEVEL, 0x09))// 0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_DAC_R1_TO_RIGHT_LOP, 0x80))	// DAC_R1 is routed to RIGHT_LOP/M
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_RIGHT_LOP_OUTPUT_LEVEL, 0x09))// 0db
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_ADDNL_GPIO_CONTROL_B, 0x01))	// CODEC_CLKIN uses CLKDIV_OUT
-		return 0;
-	if(!AIC3106_write_reg(AIC3106_REG0_CLOCK_GEN_CONTROL, 0x02))	// CLKDIV_IN/PLLCLK_IN uses MCLK, /2
+	return AIC3106_write_table(AIC3106_init_table, 
+			sizeof(AIC3106_init_table) / sizeof(AIC3106_init_table[0]));
+}
+
+#define AIC3106_I2C_ADDR          0x18   
+
+// Shadow copy of the codec's page 0 registers. A register is only
+// trusted once it has been written since the last reset.
+static Uint8 AIC3106_shadow[AIC3106_NUM_PAGE0_REGS];
+static Uint8 AIC3106_shadow_valid[AIC3106_NUM_PAGE0_REGS];
+
+PLACE_INIT_CODE(AIC3106_write_burst)
+static Uint32 AIC3106_write_burst(Uint8 address, const Uint8 *data, Uint32 count)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Writes a run of consecutive AIC3106 registers in one
+//            I2C transaction and updates the shadow copy
+//
+// Input:     address - first register address
+//            data - values for address, address+1, ...
+//            count - number of registers (at most AIC3106_MAX_BURST)
+//
+// Returns:   1 on success, 0 on I2C failure
+//
+// Calls:     Write_I2C 
+//
+// Notes:     Leading and trailing registers that already hold the
+//            requested value are not sent.
+///////////////////////////////////////////////////////////////////////
+{
+    Uint8 i2c_data[AIC3106_MAX_BURST + 1];
+    Uint32 i;
+
+	while(count > 0 && AIC3106_shadow_valid[address] && AIC3106_shadow[address] == data[0]) {
+		address++;
+		data++;
+		count--;
+	}
+	while(count > 0 && AIC3106_shadow_valid[address + count - 1] && 
+			AIC3106_shadow[address + count - 1] == data[count - 1])
+		count--;
+	if(count == 0)
+		return 1;
+
+    i2c_data[0] = address & 0x7F; 		// first register, auto-increments
+	for(i = 0; i < count; i++)
+		i2c_data[i + 1] = data[i];
+
+    if(!Write_I2C(AIC3106_I2C_ADDR, i2c_data, count + 1))
 		return 0;
+
+	for(i = 0; i < count; i++) {
+		AIC3106_shadow[address + i] = data[i];
+		AIC3106_shadow_valid[address + i] = 1;
+	}
 	return 1;
 }
 
-#define AIC3106_I2C_ADDR          0x18   
+PLACE_INIT_CODE(AIC3106_write_table)
+Uint32 AIC3106_write_table(const AIC3106_REG_VALUE *table, Uint32 num_entries)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Applies a table of page 0 register settings to the AIC3106
+//
+// Input:     table - register/value pairs, in the order to be written
+//            num_entries - number of entries in table
+//
+// Returns:   1 on success, 0 on I2C failure
+//
+// Calls:     AIC3106_write_burst 
+//
+// Notes:     Adjacent entries with consecutive register addresses are
+//            sent as one burst, so a table sorted by address needs one
+//            transaction per contiguous run. Registers whose shadow
+//            already matches are skipped.
+///////////////////////////////////////////////////////////////////////
+{
+    Uint8 data[AIC3106_MAX_BURST];
+    Uint32 i, count;
+	Uint8 first;
+
+	i = 0;
+	while(i < num_entries) {
+		first = table[i].address;
+		count = 0;
+		do {
+			data[count++] = table[i++].data;
+		} while(i < num_entries && count < AIC3106_MAX_BURST && 
+				table[i].address == first + count);
+
+		if(!AIC3106_write_burst(first, data, count))
+			return 0;
+	}
+	return 1;
+}
 
+PLACE_INIT_CODE(AIC3106_write_reg)
 Uint32 AIC3106_write_reg(Uint8 address, Uint8 data)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Writes to AIC3106 reg on I2C control link
@@ -629,20 +845,18 @@ Uint32 AIC3106_write_reg(Uint8 address, Uint8 data)
 // Input:     address - register address
 //	          data - data to write to register
 //
-// Returns:   Nothing
+// Returns:   1 on success, 0 on I2C failure
 //
-// Calls:     Write_I2C 
+// Calls:     AIC3106_write_burst 
 //
-// Notes:     None
+// Notes:     The write is skipped if the shadow shows the register
+//            already holds data.
 ///////////////////////////////////////////////////////////////////////
 {
-    Uint8 i2c_data[2];
-    i2c_data[0] = address & 0x7F; 		// register address
-    i2c_data[1] = data;					// data
-
-    return Write_I2C(AIC3106_I2C_ADDR,i2c_data, 2);
+    return AIC3106_write_burst(address & 0x7F, &data, 1);
 }
 
+PLACE_INIT_CODE(Reset_AIC3106)
 Uint32 Reset_AIC3106()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Reset AIC3106 codec
@@ -651,15 +865,26 @@ Uint32 Reset_AIC3106()
 //
 // Returns:   Nothing
 //
-// Calls:     AIC3106_write_reg 
+// Calls:     Write_I2C 
 //
-// Notes:     None
+// Notes:     Selects page 0 and issues the software reset in one burst,
+//            bypassing the shadow, then marks every shadowed register
+//            as unknown.
 ///////////////////////////////////////////////////////////////////////
 { 
-    if(!AIC3106_write_reg(AIC3106_REG0_PAGESELECT, 0 ))				 // page 0
-		return 0;
-    if(!AIC3106_write_reg(AIC3106_REG0_RESET, 0x80 ))				// software reset
+    Uint8 i2c_data[3];
+	Uint32 i;
+
+    i2c_data[0] = AIC3106_REG0_PAGESELECT;
+    i2c_data[1] = 0;					// page 0
+    i2c_data[2] = 0x80;					// software reset
+    if(!Write_I2C(AIC3106_I2C_ADDR, i2c_data, 3))
 		return 0;
+
+	for(i = 0; i < AIC3106_NUM_PAGE0_REGS; i++)
+		AIC3106_shadow_valid[i] = 0;
+	AIC3106_shadow[AIC3106_REG0_PAGESELECT] = 0;
+	AIC3106_shadow_valid[AIC3106_REG0_PAGESELECT] = 1;
 	return 1;
 }
 
@@ -671,12 +896,13 @@ Uint32 SetSampleRate_AIC3106(Uint8 nFs)
 //
 // Returns:   Nothing
 //
-// Calls:     AIC3106_write_reg 
+// Calls:     AIC3106_write_table 
 //
 // Notes:     Update SampleFreq variable with new Fs
 ///////////////////////////////////////////////////////////////////////
 {
 	Uint8	csr, pll_a;
+	AIC3106_REG_VALUE rate[2];
 
 	switch(nFs) {
 	case AIC3106Fs96kHz:
@@ -716,13 +942,14 @@ Uint32 SetSampleRate_AIC3106(Uint8 nFs)
 		SampleFreq = 48000.0F;
 		break;
 	}
-    if(!AIC3106_write_reg(AIC3106_REG0_CODEC_SAMPLE_RATE, csr)) // set N(ADC/DAC)
-		return 0;
-    if(!AIC3106_write_reg(AIC3106_REG0_PLL_A, pll_a)) 		// set Fs(ref)
-		return 0;
-	return 1;
+	rate[0].address = AIC3106_REG0_CODEC_SAMPLE_RATE;	// set N(ADC/DAC)
+	rate[0].data = csr;
+	rate[1].address = AIC3106_REG0_PLL_A;				// set Fs(ref)
+	rate[1].data = pll_a;
+	return AIC3106_write_table(rate, 2);
 }
 
+PLACE_INIT_CODE(Init_McASP0)
 void Init_McASP0()	
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Configures McASP to operate with AIC3106 acting as master
@@ -814,7 +1041,15 @@ void Init_McASP0()
 }
 
 #define UART_CLOCK  	150000000	// uart clock is 300MHz/2
+#define UART2_TX_RING_SIZE	1024		// power of two
+
+// transmit ring drained by UART2_ISR
+static Uint8 uart2_tx_ring[UART2_TX_RING_SIZE];
+static volatile Uint32 uart2_tx_head = 0;	// written by Enqueue_UART2 only
+static volatile Uint32 uart2_tx_tail = 0;	// written by UART2_ISR only
+static Uint32 uart2_tx_overflows = 0;
 
+PLACE_INIT_CODE(Init_UART2)
 void Init_UART2(Uint32 baud_rate)
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Configures UART2 to operate at the specified baud rate
@@ -825,12 +1060,15 @@ void Init_UART2(Uint32 baud_rate)
 //
 // Calls:     wait 
 //
-// Notes:     None
+// Notes:     FIFOs are enabled and UART2 is routed to CPU INT9 for
+//            the Enqueue_UART2 transmit path. Interrupts are enabled
+//            only while the ring holds data.
 ///////////////////////////////////////////////////////////////////////
 {
 	Uint32 divisor;
 	volatile Uint8 dummy;
 	UART* pUART2 =  UART2_Base;
+	INTCx *intc = INTC0_Base;
 
 	// divisor is UART_CLOCK/(baud_rate * 16) (16x oversampling)
 	// divisor is rounded by adding baud_rate*8 before division
@@ -841,8 +1079,9 @@ void Init_UART2(Uint32 baud_rate)
 
 	pUART2->dll = (divisor & 0xff);			// baud rate divisor
 	pUART2->dlh = (divisor >> 8);
-	pUART2->iir_fcr = 0x0000;				// disable FIFOs
-	pUART2->ier = 0x0000;					// disable interrupts
+	pUART2->iir_fcr = UART_FCR_FIFOEN;		// enable FIFOs first,
+	pUART2->iir_fcr = UART_FCR_FIFOEN | UART_FCR_RXCLR | UART_FCR_TXCLR;	// then clear them
+	pUART2->ier = 0x0000;					// no interrupts until there is data
 	pUART2->lcr = 0x0003;					// 8-N-1
 	pUART2->mcr = 0x0000;					// no flow control, no loopback
 	pUART2->mdr	= 0;						// use 16x oversampling
@@ -850,6 +1089,12 @@ void Init_UART2(Uint32 baud_rate)
 	pUART2->pwremu_mgmt = 0x6001;    		// tx/rx enabled
 
 	dummy = pUART2->rbr_thr;				// flush rx data
+
+	uart2_tx_head = 0;
+	uart2_tx_tail = 0;
+
+	intc->intmux2 = (intc->intmux2 & ~0x0000FF00) | (UART2_EVENT << 8);	// UART2 irq to INT9
+	IER |= 0x0202;							// enable INT9 (and NMI)
 }
 
 void Write_UART2(Uint8 c)
@@ -890,6 +1135,127 @@ void Puts_UART2(char *s)
 	}
 }
 	
+Uint32 Enqueue_UART2(const Uint8 *data, Uint32 num_bytes)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Queues bytes for interrupt-driven transmission on UART2
+//
+// Input:     data - pointer to data to send
+//            num_bytes - number of bytes to send
+//
+// Returns:   num_bytes if queued, 0 if there was not enough room
+//
+// Calls:     TxFree_UART2
+//
+// Notes:     Never blocks. Data is queued whole or not at all, so
+//            framed output is never cut short; refused data is
+//            counted by TxOverflows_UART2.
+///////////////////////////////////////////////////////////////////////
+{
+	UART* pUART2 =  UART2_Base;
+	Uint32 head = uart2_tx_head;
+	Uint32 i;
+
+	if(num_bytes > TxFree_UART2()) {
+		uart2_tx_overflows++;
+		return 0;
+	}
+
+	for(i = 0;i < num_bytes;i++)
+		uart2_tx_ring[(head + i) & (UART2_TX_RING_SIZE - 1)] = data[i];
+
+	uart2_tx_head = head + num_bytes;		// publish after the data is in place
+	pUART2->ier = UART_IER_ETBEI;			// (re)start the transmit interrupt
+	return num_bytes;
+}
+
+Uint32 EnqueueString_UART2(const char *s)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Queues a null-terminated string for UART2 transmission
+//
+// Input:     s - pointer to string
+//
+// Returns:   Number of bytes queued, 0 if there was not enough room
+//
+// Calls:     Enqueue_UART2
+//
+// Notes:     Non-blocking counterpart of Puts_UART2
+///////////////////////////////////////////////////////////////////////
+{
+	Uint32 len = 0;
+
+	while(s[len])
+		len++;
+
+	return Enqueue_UART2((const Uint8 *)s, len);
+}
+
+Uint32 TxFree_UART2()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Reports the free space in the UART2 transmit ring
+//
+// Input:     None
+//
+// Returns:   Number of bytes Enqueue_UART2 can accept
+//
+// Calls:     Nothing 
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+	return UART2_TX_RING_SIZE - (uart2_tx_head - uart2_tx_tail);
+}
+
+Uint32 TxOverflows_UART2()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Reports how often Enqueue_UART2 refused data
+//
+// Input:     None
+//
+// Returns:   Overflow count since start-up
+//
+// Calls:     Nothing 
+//
+// Notes:     None
+///////////////////////////////////////////////////////////////////////
+{
+	return uart2_tx_overflows;
+}
+
+interrupt void UART2_ISR()
+///////////////////////////////////////////////////////////////////////
+// Purpose:   UART2 interrupt service routine. Refills the transmit
+//            FIFO from the ring each time it runs empty
+//
+// Input:     None
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Turns its own interrupt off once the ring is empty
+///////////////////////////////////////////////////////////////////////
+{
+	UART* pUART2 =  UART2_Base;
+	Uint32 tail = uart2_tx_tail;
+	Uint32 head = uart2_tx_head;
+	Uint32 n = 0;
+	volatile Uint32 iir;
+
+	iir = pUART2->iir_fcr;					// acknowledge the interrupt
+
+	if(pUART2->lsr & UART_LSR_THRE) {		// FIFO empty, room for a full load
+		while(tail != head && n < UART_FIFO_DEPTH) {
+			pUART2->rbr_thr = uart2_tx_ring[tail & (UART2_TX_RING_SIZE - 1)];
+			tail++;
+			n++;
+		}
+		uart2_tx_tail = tail;
+	}
+
+	if(tail == head)
+		pUART2->ier = 0;					// nothing left to send
+}
+
 Uint8 Read_UART2()
 ///////////////////////////////////////////////////////////////////////
 // Purpose:   Reads a byte to the UART2 receiver
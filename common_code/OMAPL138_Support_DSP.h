@@ -17,6 +17,11 @@
 
 // sample rate enumeration for Init_OMAPL138 and SetSampleRate_AIC3106
 enum {AIC3106Fs48kHz, AIC3106Fs96kHz, AIC3106Fs32kHz, AIC3106Fs24kHz, AIC3106Fs16kHz, AIC3106Fs12kHz, AIC3106Fs8kHz};
+// register/value pair for AIC3106_write_table
+typedef struct {
+	Uint8 address;
+	Uint8 data;
+} AIC3106_REG_VALUE;
 // enumeration for WriteLEDs
 enum {USER_LED1=2, USER_LED2 = 1};
 
@@ -24,6 +29,10 @@ enum {USER_LED1=2, USER_LED2 = 1};
 float  GetSampleFreq();
 void   DSP_Init();
 void   DSP_Init_EDMA();
+void   Init_Cache();
+void   Disable_Cache();
+void   Cache_Invalidate(const void *, Uint32);
+void   Cache_Writeback(const void *, Uint32);
 Uint32 WriteLEDs(Uint8);
 Int32  ReadSwitches();
 void   InitDigitalOutputs();
@@ -42,6 +51,7 @@ Uint32 Init_AIC3106(Uint8);
 Uint32 Reset_AIC3106();
 Uint32 SetSampleRate_AIC3106(Uint8);
 Uint32 AIC3106_write_reg(Uint8, Uint8);
+Uint32 AIC3106_write_table(const AIC3106_REG_VALUE *, Uint32);
 void   Init_McASP0();
 void   Init_UART2(Uint32);
 void   Write_UART2(Uint8);
@@ -49,6 +59,11 @@ void   Puts_UART2(char *);
 Uint8  Read_UART2();
 Uint8  IsDataReady_UART2();
 Uint8  IsTxReady_UART2();
+Uint32 Enqueue_UART2(const Uint8 *, Uint32);
+Uint32 EnqueueString_UART2(const char *);
+Uint32 TxFree_UART2();
+Uint32 TxOverflows_UART2();
+interrupt void UART2_ISR();
 
 Uint32 ReadCodecData();
 void   WriteCodecData(Uint32);
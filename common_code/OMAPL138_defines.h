@@ -292,6 +292,12 @@ typedef struct {
 #define UART_LSR_DR			0x01
 #define UART_LSR_THRE		0x20
 #define UART_LSR_TEMT		0x40
+#define UART_IER_ETBEI		0x02	// transmitter holding register empty interrupt
+#define UART_FCR_FIFOEN		0x01
+#define UART_FCR_RXCLR		0x02
+#define UART_FCR_TXCLR		0x04
+#define UART_FIFO_DEPTH		16
+#define UART2_EVENT			69		// DSP interrupt controller event
 
 // McASP data structure 
 typedef struct {
@@ -409,6 +415,23 @@ typedef struct {
 #define EDMA3_0_PARAM_OFFSET 	0x20
 #define EDMA3_0_PARAM(x)		(EDMA3_0_PARAM_BASE + (x * EDMA3_0_PARAM_OFFSET))
 
+// C674x megamodule cache controller
+#define CACHE_L2CFG			*( volatile Uint32* )( 0x01840000 )	// L2 mode (cache size)
+#define CACHE_L1PCFG			*( volatile Uint32* )( 0x01840020 )	// L1P mode
+#define CACHE_L1DCFG			*( volatile Uint32* )( 0x01840040 )	// L1D mode
+#define CACHE_L2WBAR			*( volatile Uint32* )( 0x01844000 )	// writeback base address
+#define CACHE_L2WWC			*( volatile Uint32* )( 0x01844004 )	// writeback word count
+#define CACHE_L2WIBAR			*( volatile Uint32* )( 0x01844010 )	// writeback-invalidate base address
+#define CACHE_L2WIWC			*( volatile Uint32* )( 0x01844014 )	// writeback-invalidate word count
+#define CACHE_L2IBAR			*( volatile Uint32* )( 0x01844018 )	// invalidate base address
+#define CACHE_L2IWC			*( volatile Uint32* )( 0x0184401C )	// invalidate word count
+#define CACHE_L2WBINV			*( volatile Uint32* )( 0x01845004 )	// global writeback-invalidate
+#define CACHE_MAR(n)			*( volatile Uint32* )( 0x01848000 + 4 * (n) )	// 16 MB each
+#define CACHE_MAR_PC			0x00000001	// region may be cached
+#define CACHE_L1_MAX			7		// L1P/L1D mode: all cache (32 KB)
+#define CACHE_LINE_BYTES		128		// L2 line; block operations round to it
+#define CACHE_BLOCK_MAX_WORDS		0xFFFF		// largest word count of one block operation
+
 
 
 
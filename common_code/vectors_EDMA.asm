@@ -10,6 +10,7 @@
 
     .ref    _c_int00
     .ref	_EDMA_ISR       
+    .ref	_UART2_ISR
   
     .sect   "vectors"
 	.nocmp	; do not allow 16 bit instructions to be used in the vector table
@@ -87,7 +88,7 @@ INT8:   b _EDMA_ISR
 	NOP
 	NOP
 	NOP
-INT9:   b INT9	; stall here if interrupt occurs
+INT9:   b _UART2_ISR
 	NOP
 	NOP
 	NOP
@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: audio_file.c
+//
+// Synopsis: Memory-mapped input for the offline host tools. WAV files
+//           carry their own format; raw PCM16 files are described by
+//           the caller. decode_audio streams a recording through a
+//           decoder instance in EDMA-frame-sized slices.
+//
+//           Interleaved stereo is decoded straight out of the mapping,
+//           laid out as buffer[][] is on the board. Mono is widened
+//           into one frame of scratch first. Pages already decoded are
+//           released as the file is read, so memory use does not grow
+//           with the file.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "config.h"
+#include "frames.h"
+#include "fft.h"
+#include "events.h"
+#include "decoder.h"
+#include "audio_file.h"
+
+#define RELEASE_BYTES	(16u << 20)	// hand consumed pages back this often
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t get_u16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static int parse_wav(audio_file_t *audio, const char *path)
+{
+  const uint8_t *file = audio->file;
+  uint64_t size = audio->size, pos = 12;
+  uint32_t chunk;
+  int have_format = 0;
+
+  if(size < 12 || memcmp(file, "RIFF", 4) || memcmp(file + 8, "WAVE", 4))
+    return 0;
+
+  while(pos + 8 <= size) {
+    chunk = get_u32(file + pos + 4);
+
+    if(!memcmp(file + pos, "fmt ", 4) && chunk >= 16 && pos + 8 + chunk <= size) {
+      if(get_u16(file + pos + 8) != 1 || get_u16(file + pos + 22) != 16) {
+	fprintf(stderr, "%s: only 16-bit PCM WAV files are supported\n", path);
+	return -1;
+      }
+      audio->channels = get_u16(file + pos + 10);
+      audio->rate = get_u32(file + pos + 12);
+      have_format = 1;
+    }
+    else if(!memcmp(file + pos, "data", 4) && have_format) {
+      // Streams that were never finalised leave the size at 0 or ~0
+      if(chunk == 0 || chunk == 0xFFFFFFFF || pos + 8 + chunk > size)
+	chunk = (uint32_t)(size - pos - 8 < 0xFFFFFFFF ? size - pos - 8 : 0xFFFFFFFF);
+      audio->data = file + pos + 8;
+      audio->frames = (size - pos - 8 > chunk ? chunk : size - pos - 8) / (2 * audio->channels);
+      return 1;
+    }
+
+    pos += 8 + chunk + (chunk & 1);
+  }
+
+  fprintf(stderr, "%s: WAV file has no data chunk\n", path);
+  return -1;
+}
+
+int open_audio(audio_file_t *audio, const char *path, double raw_rate, int raw_channels)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Maps a recording and works out its format
+//
+// Input:     audio - filled in on success
+//            path - WAV or raw PCM16 file
+//            raw_rate, raw_channels - format of a raw file
+//
+// Returns:   0 on success, -1 after printing why not
+//
+// Calls:     parse_wav
+//
+// Notes:     Only mono and interleaved stereo are accepted
+///////////////////////////////////////////////////////////////////////
+{
+  struct stat st;
+  int wav;
+
+  audio->fd = open(path, O_RDONLY);
+  if(audio->fd < 0 || fstat(audio->fd, &st) < 0) {
+    perror(path);
+    if(audio->fd >= 0)
+      close(audio->fd);
+    return -1;
+  }
+  if(st.st_size == 0) {
+    fprintf(stderr, "%s is empty\n", path);
+    close(audio->fd);
+    return -1;
+  }
+
+  audio->size = st.st_size;
+  audio->file = mmap(NULL, audio->size, PROT_READ, MAP_PRIVATE, audio->fd, 0);
+  if(audio->file == MAP_FAILED) {
+    perror(path);
+    close(audio->fd);
+    return -1;
+  }
+  madvise((void *)audio->file, audio->size, MADV_SEQUENTIAL);
+
+  wav = parse_wav(audio, path);
+  if(wav == 0) {
+    audio->data = audio->file;
+    audio->channels = raw_channels;
+    audio->rate = raw_rate;
+    audio->frames = audio->size / (2 * raw_channels);
+  }
+  if(wav >= 0 && (audio->channels < 1 || audio->channels > 2)) {
+    fprintf(stderr, "%s: only mono and stereo files are supported\n", path);
+    wav = -1;
+  }
+  if(wav >= 0 && audio->rate <= 0) {
+    fprintf(stderr, "%s: bad sample rate\n", path);
+    wav = -1;
+  }
+  if(wav < 0) {
+    close_audio(audio);
+    return -1;
+  }
+
+  return 0;
+}
+
+void close_audio(audio_file_t *audio)
+{
+  munmap((void *)audio->file, audio->size);
+  close(audio->fd);
+}
+
+static uint64_t full_sample(const decoder_t *dec, uint64_t fed, uint32_t sample)
+{
+  // Event sample numbers are 32-bit and lie shortly before the clock;
+  // rebuild the high bits so hours-long files keep counting
+  return fed - (uint32_t)(dec->sample_clock - sample);
+}
+
+static uint64_t drain_events(decoder_t *dec, uint64_t fed, int channel, double rate,
+			     digit_sink_t sink, void *context)
+{
+  digit_event_t event;
+  uint64_t count = 0;
+
+  while(event_ring_pop(&dec->events, &event)) {
+    event.channel += channel;
+    sink(context, &event, full_sample(dec, fed, event.start_sample) / rate,
+	 full_sample(dec, fed, event.end_sample) / rate);
+    count++;
+  }
+  return count;
+}
+
+uint64_t decode_audio(decoder_t *dec, const audio_file_t *audio, int channel,
+		      COMPLEX *twiddle_factors, digit_sink_t sink, void *context)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Runs a whole recording through a decoder
+//
+// Input:     dec - initialized decoder instance, reset here
+//            audio - open recording
+//            channel - file channel fed to decoder channel 0
+//            twiddle_factors - FFT_LENGTH twiddle factors
+//            sink, context - receive each digit
+//
+// Returns:   Number of digits decoded
+//
+// Calls:     decoder_reset, decoder_process
+//
+// Notes:     A DUAL_CHANNEL build decodes both channels of a stereo
+//            file at once and should be given channel 0. One second
+//            of silence is fed after the end so a final digit ends.
+///////////////////////////////////////////////////////////////////////
+{
+  int16_t scratch[2 * BUFFER_COUNT];
+  const int16_t *pBuf;
+  const uint8_t *p;
+  uint64_t done = 0, events = 0, offset, released = 0;
+  long page = sysconf(_SC_PAGESIZE);
+  int i, n;
+
+  decoder_reset(dec, audio->rate);
+
+  while(done < audio->frames) {
+    n = audio->frames - done < BUFFER_COUNT ? (int)(audio->frames - done) : BUFFER_COUNT;
+
+    if(audio->channels == 2 && ((uintptr_t)audio->data & 1) == 0) {
+      pBuf = (const int16_t *)audio->data + 2 * done + channel;
+    }
+    else {
+      // Mono, or a data chunk at an odd offset: one frame of scratch
+      for(i = 0; i < n; i++) {
+	p = audio->data + 2 * audio->channels * (done + i);
+	scratch[2*i] = (int16_t)get_u16(p + 2 * (channel % audio->channels));
+	scratch[2*i + 1] = (int16_t)get_u16(p + 2 * (audio->channels - 1));
+      }
+      pBuf = scratch;
+    }
+
+    decoder_process(dec, pBuf, n, twiddle_factors);
+    done += n;
+    events += drain_events(dec, done, channel, audio->rate, sink, context);
+
+    // Drop decoded pages from this process; the page cache keeps them
+    offset = (audio->data - audio->file) + 2 * audio->channels * done;
+    if(offset - released >= RELEASE_BYTES) {
+      offset &= ~(uint64_t)(page - 1);
+      madvise((void *)(audio->file + released), offset - released, MADV_DONTNEED);
+      released = offset;
+    }
+  }
+
+  // Let a digit at the very end run out
+  memset(scratch, 0, sizeof(scratch));
+  for(i = 0; i < (int)(audio->rate / BUFFER_COUNT) + 1; i++) {
+    decoder_process(dec, scratch, BUFFER_COUNT, twiddle_factors);
+    done += BUFFER_COUNT;
+    events += drain_events(dec, done, channel, audio->rate, sink, context);
+  }
+
+  return events;
+}
@@ -0,0 +1,34 @@
+/*
+ * audio_file.h
+ *
+ * Memory-mapped WAV / raw PCM16 recordings, and the loop that feeds
+ * one through a decoder instance. Shared by the offline host tools.
+ */
+
+#ifndef HOST_AUDIO_FILE_H_
+#define HOST_AUDIO_FILE_H_
+
+#include <stdint.h>
+#include "fft.h"
+#include "events.h"
+#include "decoder.h"
+
+typedef struct {
+  const uint8_t *file;		// whole mapping
+  uint64_t size;
+  const uint8_t *data;		// first sample
+  uint64_t frames;		// sample frames (one sample per channel)
+  int channels;
+  double rate;
+  int fd;
+} audio_file_t;
+
+// Receives each decoded digit, with times in seconds from the start of the file
+typedef void (*digit_sink_t)(void *context, const digit_event_t *event, double start, double end);
+
+int open_audio(audio_file_t *audio, const char *path, double raw_rate, int raw_channels);
+void close_audio(audio_file_t *audio);
+uint64_t decode_audio(decoder_t *dec, const audio_file_t *audio, int channel,
+		      COMPLEX *twiddle_factors, digit_sink_t sink, void *context);
+
+#endif /* HOST_AUDIO_FILE_H_ */
@@ -0,0 +1,374 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: batch_decode.c
+//
+// Synopsis: Decodes many recordings at once, one decoder instance per
+//           worker thread. Files are dealt out largest first onto
+//           per-worker deques; a worker runs its own tasks newest
+//           first and, when it runs dry, steals the oldest task of a
+//           random other worker. The second channel of a stereo file
+//           is pushed as a task of its own once the file turns out to
+//           be stereo, so the two halves can run on different cores.
+//
+//           Tasks are whole channels, seconds of work each, so a mutex
+//           per deque costs nothing measurable; every worker has its
+//           own decoder, FFT scratch and twiddle table, and nothing is
+//           shared on the decode path.
+//
+// Usage:    batch_decode [-j threads] [-r rate] [-c channels]
+//                        [-o events.csv] [--scaling] file...
+//
+//           -r and -c describe raw files as for wav_decode. With
+//           --scaling the batch is run at 1, 2, 4, ... threads up to
+//           -j and a throughput table is printed instead of events.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "config.h"
+#include "fft.h"
+#include "events.h"
+#include "arena.h"
+#include "decoder.h"
+#include "audio_file.h"
+
+typedef struct {
+  int file;			// index into the file list
+  int channel;
+} task_t;
+
+// Owner works at the bottom, thieves take from the top
+typedef struct {
+  pthread_mutex_t lock;
+  int *slots;
+  int top, bottom;
+} deque_t;
+
+typedef struct {
+  int id;
+  deque_t deque;
+  decoder_t *decoder;
+  void *decoder_memory;		// arena for the decoder's buffers
+  COMPLEX twiddle_factors[FFT_LENGTH];
+  uint32_t rng;
+  // results
+  uint64_t tasks, steals, digits;
+  double audio_seconds, busy_seconds;
+} worker_t;
+
+typedef struct {
+  const char *path;
+  off_t size;
+} input_t;
+
+static input_t *inputs;
+static int num_inputs;
+static task_t *tasks;		// file i channel c is task c*num_inputs + i
+static worker_t *workers;
+static int num_workers;
+static volatile int outstanding;	// tasks queued or running
+static double raw_rate = SAMPLING_FREQUENCY;
+static int raw_channels = 1;
+static FILE *out;
+static pthread_mutex_t out_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void deque_push(deque_t *d, int task)
+{
+  pthread_mutex_lock(&d->lock);
+  d->slots[d->bottom++] = task;
+  pthread_mutex_unlock(&d->lock);
+}
+
+static int deque_pop(deque_t *d)
+{
+  int task = -1;
+
+  pthread_mutex_lock(&d->lock);
+  if(d->bottom > d->top)
+    task = d->slots[--d->bottom];
+  pthread_mutex_unlock(&d->lock);
+  return task;
+}
+
+static int deque_steal(deque_t *d)
+{
+  int task = -1;
+
+  pthread_mutex_lock(&d->lock);
+  if(d->bottom > d->top)
+    task = d->slots[d->top++];
+  pthread_mutex_unlock(&d->lock);
+  return task;
+}
+
+static int next_task(worker_t *w)
+{
+  int task, i, victim;
+
+  task = deque_pop(&w->deque);
+  if(task >= 0)
+    return task;
+
+  // Try every other worker once, starting at a random one
+  w->rng ^= w->rng << 13;
+  w->rng ^= w->rng >> 17;
+  w->rng ^= w->rng << 5;
+  victim = w->rng % num_workers;
+  for(i = 0; i < num_workers; i++, victim = (victim + 1) % num_workers) {
+    if(victim == w->id)
+      continue;
+    task = deque_steal(&workers[victim].deque);
+    if(task >= 0) {
+      w->steals++;
+      return task;
+    }
+  }
+  return -1;
+}
+
+typedef struct {
+  FILE *lines;
+  const char *path;
+} sink_t;
+
+static void collect_event(void *context, const digit_event_t *event, double start, double end)
+{
+  sink_t *sink = context;
+
+  fprintf(sink->lines, "\"%s\",%u,%c,%.4f,%.4f,%u\n", sink->path,
+	  event->channel, event->digit, start, end, event->confidence);
+}
+
+static void ignore_event(void *context, const digit_event_t *event, double start, double end)
+{
+}
+
+static void run_task(worker_t *w, int task)
+{
+  const task_t *t = &tasks[task];
+  audio_file_t audio;
+  sink_t sink;
+  char *text = NULL;
+  size_t length = 0;
+  double start = now();
+
+  if(open_audio(&audio, inputs[t->file].path, raw_rate, raw_channels) == 0) {
+#ifndef DUAL_CHANNEL
+    // The other channel is separate work; let an idle worker take it
+    if(t->channel == 0 && audio.channels == 2) {
+      __sync_fetch_and_add(&outstanding, 1);
+      deque_push(&w->deque, num_inputs + t->file);
+    }
+#endif
+    sink.path = inputs[t->file].path;
+    sink.lines = out ? open_memstream(&text, &length) : NULL;
+
+    w->digits += decode_audio(w->decoder, &audio, t->channel, w->twiddle_factors,
+			      sink.lines ? collect_event : ignore_event, &sink);
+    w->audio_seconds += audio.frames / audio.rate;
+    close_audio(&audio);
+
+    // One task's digits stay together in the output
+    if(sink.lines) {
+      fclose(sink.lines);
+      pthread_mutex_lock(&out_lock);
+      fwrite(text, 1, length, out);
+      pthread_mutex_unlock(&out_lock);
+      free(text);
+    }
+  }
+
+  w->tasks++;
+  w->busy_seconds += now() - start;
+  __sync_fetch_and_sub(&outstanding, 1);
+}
+
+static void *worker_main(void *arg)
+{
+  worker_t *w = arg;
+  int task;
+
+  while(outstanding > 0) {
+    task = next_task(w);
+    if(task >= 0)
+      run_task(w, task);
+    else
+      sched_yield();
+  }
+  return NULL;
+}
+
+static int by_size(const void *a, const void *b)
+{
+  const input_t *x = a, *y = b;
+
+  return (y->size > x->size) - (y->size < x->size);
+}
+
+static double run_batch(int threads)
+{
+  pthread_t *ids = malloc(threads * sizeof(pthread_t));
+  double start;
+  int i;
+
+  num_workers = threads;
+  workers = calloc(threads, sizeof(worker_t));
+  for(i = 0; i < threads; i++) {
+    worker_t *w = &workers[i];
+    arena_t arena;
+
+    w->id = i;
+    w->rng = 2463534242u + i;
+    pthread_mutex_init(&w->deque.lock, NULL);
+    w->deque.slots = malloc(2 * num_inputs * sizeof(int));
+    if(posix_memalign((void **)&w->decoder, 64, sizeof(decoder_t)) != 0 ||
+       posix_memalign(&w->decoder_memory, 64, DECODER_ARENA_BYTES) != 0) {
+      perror("posix_memalign");
+      exit(1);
+    }
+    init_arena(&arena, w->decoder_memory, DECODER_ARENA_BYTES);
+    init_decoder(w->decoder, &arena, raw_rate);
+    init_W(FFT_LENGTH, w->twiddle_factors);
+  }
+
+  // Deal round robin, smallest first, so each worker starts on its
+  // largest file; stealing evens out the rest
+  outstanding = num_inputs;
+  for(i = 0; i < num_inputs; i++)
+    deque_push(&workers[i % threads].deque, num_inputs - 1 - i);
+
+  start = now();
+  for(i = 0; i < threads; i++)
+    pthread_create(&ids[i], NULL, worker_main, &workers[i]);
+  for(i = 0; i < threads; i++)
+    pthread_join(ids[i], NULL);
+
+  free(ids);
+  return now() - start;
+}
+
+static void free_batch(void)
+{
+  int i;
+
+  for(i = 0; i < num_workers; i++) {
+    pthread_mutex_destroy(&workers[i].deque.lock);
+    free(workers[i].deque.slots);
+    decoder_destroy(workers[i].decoder);
+    free(workers[i].decoder);
+    free(workers[i].decoder_memory);
+  }
+  free(workers);
+}
+
+static void summarize(double wall, double base_wall)
+{
+  uint64_t total_tasks = 0, total_steals = 0, digits = 0;
+  double audio = 0, min_busy = 1e30, max_busy = 0;
+  int i;
+
+  for(i = 0; i < num_workers; i++) {
+    total_tasks += workers[i].tasks;
+    total_steals += workers[i].steals;
+    digits += workers[i].digits;
+    audio += workers[i].audio_seconds;
+    if(workers[i].busy_seconds < min_busy)
+      min_busy = workers[i].busy_seconds;
+    if(workers[i].busy_seconds > max_busy)
+      max_busy = workers[i].busy_seconds;
+  }
+
+  if(base_wall > 0)
+    printf("%7d %8.2f %10.0f %8.2f %9.0f%% %8.0f%% %7llu\n", num_workers, wall, audio / wall,
+	   base_wall / wall, 100.0 * base_wall / wall / num_workers,
+	   max_busy > 0 ? 100.0 * min_busy / max_busy : 100.0, (unsigned long long)total_steals);
+  else
+    fprintf(stderr, "%llu digits from %llu channels, %.1f h of audio in %.2f s on %d threads "
+	    "(%.0fx real time, %llu steals)\n", (unsigned long long)digits,
+	    (unsigned long long)total_tasks, audio / 3600, wall, num_workers,
+	    audio / wall, (unsigned long long)total_steals);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *out_path = NULL;
+  struct stat st;
+  double wall, base_wall = 0;
+  int i, threads = (int)sysconf(_SC_NPROCESSORS_ONLN), scaling = 0;
+
+  inputs = calloc(argc, sizeof(input_t));
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-j") && i + 1 < argc)
+      threads = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      raw_rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-c") && i + 1 < argc)
+      raw_channels = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-o") && i + 1 < argc)
+      out_path = argv[++i];
+    else if(!strcmp(argv[i], "--scaling"))
+      scaling = 1;
+    else if(argv[i][0] != '-')
+      inputs[num_inputs++].path = argv[i];
+    else
+      num_inputs = 0, i = argc;
+  }
+  if(num_inputs == 0 || threads < 1 || raw_channels < 1 || raw_channels > 2 || raw_rate <= 0) {
+    fprintf(stderr, "usage: %s [-j threads] [-r rate] [-c 1|2] [-o events.csv] [--scaling] file...\n", argv[0]);
+    return 2;
+  }
+
+  for(i = 0; i < num_inputs; i++)
+    inputs[i].size = stat(inputs[i].path, &st) == 0 ? st.st_size : 0;
+  qsort(inputs, num_inputs, sizeof(input_t), by_size);
+
+  tasks = malloc(2 * num_inputs * sizeof(task_t));
+  for(i = 0; i < 2 * num_inputs; i++) {
+    tasks[i].file = i % num_inputs;
+    tasks[i].channel = i / num_inputs;
+  }
+
+  if(scaling) {
+    printf("threads   wall_s  x_realtime  speedup efficiency  balance  steals\n");
+    for(i = 1; ; i = i * 2 > threads && i < threads ? threads : i * 2) {
+      wall = run_batch(i);
+      if(i == 1)
+	base_wall = wall;
+      summarize(wall, base_wall);
+      free_batch();
+      if(i >= threads)
+	break;
+    }
+    return 0;
+  }
+
+  out = out_path ? fopen(out_path, "w") : stdout;
+  if(!out) {
+    perror(out_path);
+    return 1;
+  }
+  fprintf(out, "file,channel,digit,start_s,end_s,confidence\n");
+
+  wall = run_batch(threads);
+  summarize(wall, 0);
+  free_batch();
+
+  if(out != stdout)
+    fclose(out);
+  return 0;
+}
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: decimator_design.c
+//
+// Synopsis: Host tool that designs the anti-alias filter of the
+//           decimator (appendix_a/decimator.c) and writes it as
+//           appendix_a/decimator_taps.h. The filter is a Kaiser-
+//           windowed sinc, cut off halfway between the pass and stop
+//           edges and scaled to unity gain at DC. Its taps are
+//           written in polyphase order: one row per input phase,
+//           oldest sample first, as decimator_process reads them.
+//           The response is checked on a fine grid and printed to
+//           stderr.
+//
+// Usage:    decimator_design [-M factor] [-t taps] [-r rate] [-p Hz]
+//                            [-s Hz] [-a dB] > decimator_taps.h
+//
+//           -M decimation factor (6), -t taps per phase (16),
+//           -r input rate (48000), -p pass edge (1800 Hz, above the
+//           highest DTFM tone), -s stop edge (4000 Hz, the output's
+//           Nyquist), -a stopband attenuation the window aims at
+//           (70 dB).
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define MAX_TAPS	1024
+#define GRID_POINTS	4096
+
+typedef struct {
+  int factor;
+  int phase_taps;
+  double rate;
+  double pass_hz;
+  double stop_hz;
+  double attenuation_db;
+} design_t;
+
+// Zeroth-order modified Bessel function of the first kind
+static double bessel_i0(double x)
+{
+  double sum = 1.0, term = 1.0;
+  int k;
+
+  for(k = 1; k < 50; k++) {
+    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+    sum += term;
+    if(term < 1e-12 * sum)
+      break;
+  }
+  return sum;
+}
+
+static double kaiser_beta(double attenuation_db)
+{
+  if(attenuation_db > 50.0)
+    return 0.1102 * (attenuation_db - 8.7);
+  if(attenuation_db >= 21.0)
+    return 0.5842 * pow(attenuation_db - 21.0, 0.4) + 0.07886 * (attenuation_db - 21.0);
+  return 0.0;
+}
+
+static void design(const design_t *d, double *h, int taps)
+{
+  double cutoff = (d->pass_hz + d->stop_hz) / 2.0 / d->rate;	// cycles per sample
+  double beta = kaiser_beta(d->attenuation_db);
+  double centre = (taps - 1) / 2.0, t, r, sum = 0.0;
+  int n;
+
+  for(n = 0; n < taps; n++) {
+    t = n - centre;
+    h[n] = t == 0.0 ? 2.0 * cutoff : sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+    r = t / centre;
+    h[n] *= bessel_i0(beta * sqrt(1.0 - r * r)) / bessel_i0(beta);
+    sum += h[n];
+  }
+  for(n = 0; n < taps; n++)
+    h[n] /= sum;
+}
+
+static double gain_db(const double *h, int taps, double hz, double rate)
+{
+  double re = 0.0, im = 0.0, w = 2.0 * M_PI * hz / rate;
+  int n;
+
+  for(n = 0; n < taps; n++) {
+    re += h[n] * cos(w * n);
+    im -= h[n] * sin(w * n);
+  }
+  return 10.0 * log10(re * re + im * im + 1e-30);
+}
+
+int main(int argc, char *argv[])
+{
+  design_t d = { 6, 16, 48000.0, 1800.0, 4000.0, 70.0 };
+  double h[MAX_TAPS], f, g, ripple = 0.0, stop = -1000.0;
+  int taps, p, t, i;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-M") && i + 1 < argc)
+      d.factor = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-t") && i + 1 < argc)
+      d.phase_taps = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      d.rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-p") && i + 1 < argc)
+      d.pass_hz = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-s") && i + 1 < argc)
+      d.stop_hz = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-a") && i + 1 < argc)
+      d.attenuation_db = atof(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s [-M factor] [-t taps] [-r rate] [-p Hz] [-s Hz] [-a dB]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  taps = d.factor * d.phase_taps;
+  if(d.factor < 2 || d.phase_taps < 1 || taps > MAX_TAPS ||
+     d.pass_hz <= 0.0 || d.stop_hz <= d.pass_hz || d.stop_hz > d.rate / 2.0) {
+    fprintf(stderr, "%s: bad design parameters\n", argv[0]);
+    return 1;
+  }
+
+  design(&d, h, taps);
+
+  for(i = 0; i <= GRID_POINTS; i++) {
+    f = d.rate / 2.0 * i / GRID_POINTS;
+    g = gain_db(h, taps, f, d.rate);
+    if(f <= d.pass_hz && fabs(g) > ripple)
+      ripple = fabs(g);
+    if(f >= d.stop_hz && g > stop)
+      stop = g;
+  }
+  fprintf(stderr, "%d taps, %d per phase: passband within %.3f dB to %.0f Hz, stopband %.1f dB from %.0f Hz\n",
+	  taps, d.phase_taps, ripple, d.pass_hz, stop, d.stop_hz);
+
+  printf("/*\n"
+	 " * decimator_taps.h\n"
+	 " *\n"
+	 " * Generated by host/decimator_design -M %d -t %d -r %.0f -p %.0f -s %.0f -a %.0f\n"
+	 " * Do not edit; rerun the generator (see README.md).\n"
+	 " *\n"
+	 " * Kaiser-windowed sinc, %d taps, cut off at %.0f Hz of %.0f Hz, unity\n"
+	 " * gain at DC. Passband within %.3f dB to %.0f Hz, stopband %.1f dB from\n"
+	 " * %.0f Hz. Row p holds the taps for the input samples that arrive in\n"
+	 " * phase p of each output period, oldest first. Included by\n"
+	 " * decimator.c only.\n"
+	 " */\n\n",
+	 d.factor, d.phase_taps, d.rate, d.pass_hz, d.stop_hz, d.attenuation_db,
+	 taps, (d.pass_hz + d.stop_hz) / 2.0, d.rate, ripple, d.pass_hz, stop, d.stop_hz);
+  printf("#ifndef APPENDIX_A_DECIMATOR_TAPS_H_\n"
+	 "#define APPENDIX_A_DECIMATOR_TAPS_H_\n\n"
+	 "#include \"placement.h\"\n\n"
+	 "#define DECIMATOR_TAPS_FACTOR %d\n"
+	 "#define DECIMATOR_TAPS_PER_PHASE %d\n\n"
+	 "PLACE_HOT(decimator_taps)\n"
+	 "const float decimator_taps[DECIMATOR_TAPS_FACTOR][DECIMATOR_TAPS_PER_PHASE] = {\n",
+	 d.factor, d.phase_taps);
+
+  // Output m is sum h[k] x[mM + M-1 - k]: phase p at age j (0 newest)
+  // takes h[jM + M-1 - p], and the delay line is read oldest first
+  for(p = 0; p < d.factor; p++) {
+    printf("  {");
+    for(t = 0; t < d.phase_taps; t++)
+      printf("%s%.9gf", t ? (t % 4 ? ", " : ",\n   ") : " ",
+	     h[(d.phase_taps - 1 - t) * d.factor + d.factor - 1 - p]);
+    printf(" }%s\n", p < d.factor - 1 ? "," : "");
+  }
+  printf("};\n\n#endif /* APPENDIX_A_DECIMATOR_TAPS_H_ */\n");
+  return 0;
+}
@@ -0,0 +1,314 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: goertzel_bank.c
+//
+// Synopsis: Goertzel detector bank for many channels. Frames are
+//           interleaved like buffer[ready_index] on the board, but
+//           with any number of channels: sample t of channel c is
+//           frame[t*channels + c]. Each block, every channel's eight
+//           tone powers are classified into a character.
+//
+//           The kernels walk the frame one group of channels at a
+//           time and keep that group's sixteen state vectors in
+//           registers for the whole frame, so state only goes to
+//           memory once per write. Channels left over after the last
+//           full group are done by the scalar kernel.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "fft.h"
+#include "dtfm.h"
+#include "goertzel_bank.h"
+
+// Per-tone amplitude (in ADC counts) a tone has to exceed
+#define GOERTZEL_ON_AMPLITUDE	300.0f
+
+// Share of N * block energy the two strongest tones must hold. A clean
+// digit filling the block holds 0.5; one covering half of it, 0.25.
+// Noise alone stays far below.
+#ifndef GOERTZEL_MIN_SHARE
+#define GOERTZEL_MIN_SHARE	0.2f
+#endif
+
+#if defined(__AVX512F__)
+#define KERNEL_LANES 16
+#elif defined(__AVX2__)
+#define KERNEL_LANES 8
+#else
+#define KERNEL_LANES 1
+#endif
+
+static void goertzel_scalar(goertzel_bank_t *bank, const int16_t *frame, int num_samples, int first)
+{
+  int c, t, k;
+  float x, s0, s1[DTFM_NUM_TONES], s2[DTFM_NUM_TONES], e;
+
+  for(c = first; c < bank->channels; c++) {
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      s1[k] = bank->s1[k * bank->stride + c];
+      s2[k] = bank->s2[k * bank->stride + c];
+    }
+    e = bank->energy[c];
+
+    for(t = 0; t < num_samples; t++) {
+      x = frame[t * bank->channels + c];
+      e += x * x;
+      for(k = 0; k < DTFM_NUM_TONES; k++) {
+	s0 = x + bank->coeff[k] * s1[k] - s2[k];
+	s2[k] = s1[k];
+	s1[k] = s0;
+      }
+    }
+
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      bank->s1[k * bank->stride + c] = s1[k];
+      bank->s2[k * bank->stride + c] = s2[k];
+    }
+    bank->energy[c] = e;
+  }
+}
+
+#if defined(__AVX512F__)
+
+static int goertzel_vector(goertzel_bank_t *bank, const int16_t *frame, int num_samples)
+{
+  int c, t, k, groups = bank->channels / 16;
+  __m512 x, s0, s1[DTFM_NUM_TONES], s2[DTFM_NUM_TONES], coeff[DTFM_NUM_TONES], e;
+
+  for(k = 0; k < DTFM_NUM_TONES; k++)
+    coeff[k] = _mm512_set1_ps(bank->coeff[k]);
+
+  for(c = 0; c < groups * 16; c += 16) {
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      s1[k] = _mm512_load_ps(&bank->s1[k * bank->stride + c]);
+      s2[k] = _mm512_load_ps(&bank->s2[k * bank->stride + c]);
+    }
+    e = _mm512_load_ps(&bank->energy[c]);
+
+    for(t = 0; t < num_samples; t++) {
+      x = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(
+	    _mm256_loadu_si256((const __m256i *)&frame[t * bank->channels + c])));
+      e = _mm512_fmadd_ps(x, x, e);
+      for(k = 0; k < DTFM_NUM_TONES; k++) {
+	s0 = _mm512_fmadd_ps(coeff[k], s1[k], _mm512_sub_ps(x, s2[k]));
+	s2[k] = s1[k];
+	s1[k] = s0;
+      }
+    }
+
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      _mm512_store_ps(&bank->s1[k * bank->stride + c], s1[k]);
+      _mm512_store_ps(&bank->s2[k * bank->stride + c], s2[k]);
+    }
+    _mm512_store_ps(&bank->energy[c], e);
+  }
+
+  return groups * 16;
+}
+
+#elif defined(__AVX2__)
+
+static int goertzel_vector(goertzel_bank_t *bank, const int16_t *frame, int num_samples)
+{
+  int c, t, k, groups = bank->channels / 8;
+  __m256 x, s0, s1[DTFM_NUM_TONES], s2[DTFM_NUM_TONES], e;
+
+  for(c = 0; c < groups * 8; c += 8) {
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      s1[k] = _mm256_load_ps(&bank->s1[k * bank->stride + c]);
+      s2[k] = _mm256_load_ps(&bank->s2[k * bank->stride + c]);
+    }
+    e = _mm256_load_ps(&bank->energy[c]);
+
+    for(t = 0; t < num_samples; t++) {
+      x = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+	    _mm_loadu_si128((const __m128i *)&frame[t * bank->channels + c])));
+#ifdef __FMA__
+      e = _mm256_fmadd_ps(x, x, e);
+#else
+      e = _mm256_add_ps(_mm256_mul_ps(x, x), e);
+#endif
+      // Sixteen state registers leave none for the coefficients, so
+      // they are broadcast from memory as operands
+      for(k = 0; k < DTFM_NUM_TONES; k++) {
+#ifdef __FMA__
+	s0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&bank->coeff[k]), s1[k], _mm256_sub_ps(x, s2[k]));
+#else
+	s0 = _mm256_add_ps(_mm256_mul_ps(_mm256_broadcast_ss(&bank->coeff[k]), s1[k]), _mm256_sub_ps(x, s2[k]));
+#endif
+	s2[k] = s1[k];
+	s1[k] = s0;
+      }
+    }
+
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      _mm256_store_ps(&bank->s1[k * bank->stride + c], s1[k]);
+      _mm256_store_ps(&bank->s2[k * bank->stride + c], s2[k]);
+    }
+    _mm256_store_ps(&bank->energy[c], e);
+  }
+
+  return groups * 8;
+}
+
+#else
+
+static int goertzel_vector(goertzel_bank_t *bank, const int16_t *frame, int num_samples)
+{
+  return 0;
+}
+
+#endif
+
+const char *goertzel_bank_kernel(void)
+{
+#if KERNEL_LANES == 16
+  return "avx512";
+#elif KERNEL_LANES == 8
+  return "avx2";
+#else
+  return "scalar";
+#endif
+}
+
+static void clear_state(goertzel_bank_t *bank)
+{
+  memset(bank->s1, 0, DTFM_NUM_TONES * bank->stride * sizeof(float));
+  memset(bank->s2, 0, DTFM_NUM_TONES * bank->stride * sizeof(float));
+  memset(bank->energy, 0, bank->stride * sizeof(float));
+  bank->fill = 0;
+}
+
+int init_goertzel_bank(goertzel_bank_t *bank, int channels, float sample_rate)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sets up a detector bank
+//
+// Input:     bank - bank to initialize
+//            channels - number of interleaved channels in each frame
+//            sample_rate - sample rate in Hz
+//
+// Returns:   0 on success, -1 if memory ran out
+//
+// Calls:     clear_state
+//
+// Notes:     State rows are 64-byte aligned for the vector kernels
+///////////////////////////////////////////////////////////////////////
+{
+  size_t row;
+  float amplitude;
+  int k;
+
+  bank->channels = channels;
+  bank->stride = (channels + GOERTZEL_LANES - 1) / GOERTZEL_LANES * GOERTZEL_LANES;
+  bank->block_length = (int)(GOERTZEL_BLOCK_LENGTH * sample_rate / 8000.0f + 0.5f);
+
+  for(k = 0; k < DTFM_NUM_TONES; k++)
+    bank->coeff[k] = (float)(2.0 * cos(2.0 * MYPI * dtfm_tone_freqs[k] / sample_rate));
+
+  amplitude = GOERTZEL_ON_AMPLITUDE * bank->block_length / 2.0f;
+  bank->on_power = amplitude * amplitude;
+
+  row = bank->stride * sizeof(float);
+  bank->s1 = aligned_alloc(64, DTFM_NUM_TONES * row);
+  bank->s2 = aligned_alloc(64, DTFM_NUM_TONES * row);
+  bank->energy = aligned_alloc(64, row);
+  bank->detected = calloc(channels, 1);
+  if(!bank->s1 || !bank->s2 || !bank->energy || !bank->detected) {
+    free_goertzel_bank(bank);
+    return -1;
+  }
+
+  clear_state(bank);
+  return 0;
+}
+
+void free_goertzel_bank(goertzel_bank_t *bank)
+{
+  free(bank->s1);
+  free(bank->s2);
+  free(bank->energy);
+  free(bank->detected);
+  bank->s1 = bank->s2 = bank->energy = NULL;
+  bank->detected = NULL;
+}
+
+int goertzel_bank_write(goertzel_bank_t *bank, const int16_t *frame, int num_samples)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Runs every channel's filters over interleaved samples
+//
+// Input:     bank - bank to feed
+//            frame - num_samples rows of bank->channels samples
+//            num_samples - rows available
+//
+// Returns:   Number of rows consumed
+//
+// Calls:     goertzel_vector, goertzel_scalar
+//
+// Notes:     Stops early when a block completes, so the caller can
+//            run goertzel_bank_classify before the next block starts
+///////////////////////////////////////////////////////////////////////
+{
+  int n = bank->block_length - bank->fill;
+
+  if(n > num_samples)
+    n = num_samples;
+
+  goertzel_scalar(bank, frame, n, goertzel_vector(bank, frame, n));
+
+  bank->fill += n;
+  return n;
+}
+
+int goertzel_bank_block_ready(const goertzel_bank_t *bank)
+{
+  return bank->fill == bank->block_length;
+}
+
+void goertzel_bank_classify(goertzel_bank_t *bank)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Turns the finished block into one character per channel
+//            and starts the next block
+//
+// Input:     bank - bank with a complete block
+//
+// Returns:   Nothing
+//
+// Calls:     determine_character, clear_state
+//
+// Notes:     bank->detected holds '\0' for channels without a digit
+///////////////////////////////////////////////////////////////////////
+{
+  int c, k, row, col;
+  float s1, s2, power[DTFM_NUM_TONES];
+
+  for(c = 0; c < bank->channels; c++) {
+    for(k = 0; k < DTFM_NUM_TONES; k++) {
+      s1 = bank->s1[k * bank->stride + c];
+      s2 = bank->s2[k * bank->stride + c];
+      power[k] = s1 * s1 + s2 * s2 - bank->coeff[k] * s1 * s2;
+    }
+
+    row = 0;
+    col = DTFM_NUM_ROWS;
+    for(k = 1; k < DTFM_NUM_ROWS; k++)
+      if(power[k] > power[row])
+	row = k;
+    for(k = DTFM_NUM_ROWS + 1; k < DTFM_NUM_TONES; k++)
+      if(power[k] > power[col])
+	col = k;
+
+    if(power[row] < bank->on_power || power[col] < bank->on_power ||
+       power[row] + power[col] < GOERTZEL_MIN_SHARE * bank->block_length * bank->energy[c])
+      bank->detected[c] = '\0';
+    else
+      bank->detected[c] = determine_character(dtfm_tone_freqs[row], dtfm_tone_freqs[col]);
+  }
+
+  clear_state(bank);
+}
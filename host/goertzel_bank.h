@@ -0,0 +1,43 @@
+/*
+ * goertzel_bank.h
+ *
+ * DTFM detection on many channels at once. Each channel runs a
+ * Goertzel filter per DTFM tone over fixed blocks. The filter state is
+ * kept structure-of-arrays (one row per tone, one column per channel),
+ * so one vector instruction advances 8 (AVX2) or 16 (AVX-512) channels.
+ * Which kernel is used is decided at compile time (-mavx2 -mfma,
+ * -mavx512f or -march=native); without them a scalar loop is built.
+ */
+
+#ifndef HOST_GOERTZEL_BANK_H_
+#define HOST_GOERTZEL_BANK_H_
+
+#include <stdint.h>
+#include "dtfm.h"
+
+// Block length at 8 kHz. 205 points put every DTFM tone within 1% of an
+// integer bin; other rates scale it to keep the same duration.
+#define GOERTZEL_BLOCK_LENGTH	205
+
+#define GOERTZEL_LANES		16	// state rows are padded to this many channels
+
+typedef struct {
+  int channels;
+  int stride;			// channels rounded up to GOERTZEL_LANES
+  int block_length;		// samples per classification
+  int fill;			// samples into the current block
+  float coeff[DTFM_NUM_TONES];	// 2cos(w) per tone
+  float on_power;		// tone power a digit needs, per tone
+  float *s1, *s2;		// [DTFM_NUM_TONES][stride]
+  float *energy;		// [stride], sum of x^2 over the block
+  char *detected;		// [channels], result of the last block
+} goertzel_bank_t;
+
+int init_goertzel_bank(goertzel_bank_t *bank, int channels, float sample_rate);
+void free_goertzel_bank(goertzel_bank_t *bank);
+int goertzel_bank_write(goertzel_bank_t *bank, const int16_t *frame, int num_samples);
+int goertzel_bank_block_ready(const goertzel_bank_t *bank);
+void goertzel_bank_classify(goertzel_bank_t *bank);
+const char *goertzel_bank_kernel(void);
+
+#endif /* HOST_GOERTZEL_BANK_H_ */
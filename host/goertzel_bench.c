@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: goertzel_bench.c
+//
+// Synopsis: Throughput and accuracy of the Goertzel detector bank.
+//           Every channel dials its own random digits, offset in time
+//           from its neighbours, with noise added. Frames of
+//           BUFFER_COUNT samples are interleaved across all channels
+//           as a line card would deliver them. Prints how many
+//           channels one core keeps up with at real time, and how many
+//           digits were found.
+//
+// Usage:    goertzel_bench [-c channels] [-s seconds] [-r rate]
+//                          [--snr dB] [--on ms] [--off ms] [--seed n]
+//
+//           Only the detector and segmentation are timed; generating
+//           the test signal is not.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "config.h"
+#include "frames.h"
+#include "fft.h"
+#include "dtfm.h"
+#include "events.h"
+#include "segmenter.h"
+#include "goertzel_bank.h"
+
+#define LEAD_IN_MS	100
+#define TONE_LEVEL	4000.0f		// per tone, ADC counts
+
+static const char keypad[] = "123A456B789C*0#D";
+
+typedef struct {
+  int channels;
+  double seconds;
+  float rate;
+  double snr_db;
+  int on_ms, off_ms;
+  uint32_t seed;
+} bench_config_t;
+
+// Per-channel test signal
+typedef struct {
+  uint32_t offset;		// start of the first digit
+  float low_phase, high_phase;
+  float low_step, high_step;
+  int current;			// digit index being rendered, -1 before the first
+} channel_t;
+
+static uint32_t rng_state;
+
+static uint32_t rng_next(void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+static float rng_noise(void)
+{
+  // Sum of four uniforms: close enough to Gaussian, unit variance
+  float sum = 0;
+  int i;
+
+  for(i = 0; i < 4; i++)
+    sum += (rng_next() >> 8) * (1.0f / 16777216.0f);
+  return (sum - 2.0f) * 1.7320508f;
+}
+
+static char digit_of(const bench_config_t *cfg, int channel, int index)
+{
+  uint32_t h = (channel * 2654435761u) ^ (index * 40503u) ^ cfg->seed;
+
+  h ^= h >> 15;
+  h *= 2246822519u;
+  h ^= h >> 13;
+  return keypad[h % 16];
+}
+
+static double elapsed_seconds(const struct timespec *a, const struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) + (b->tv_nsec - a->tv_nsec) * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+  int16_t *frame;
+  bench_config_t cfg;
+  goertzel_bank_t bank;
+  segmenter_t *segmenters;
+  event_ring_t events;
+  digit_event_t event;
+  channel_t *ch;
+  uint8_t *matched;
+  struct timespec t0, t1;
+  uint32_t on, period, lead, total, sample, stamp, s, mid;
+  int per_channel, i, c, t, n, done, index, key;
+  uint64_t hits = 0, false_digits = 0, expected = 0;
+  double decode_time = 0.0, noise_sigma, audio;
+  float v;
+
+  cfg.channels = 256;
+  cfg.seconds = 4.0;
+  cfg.rate = 8000.0f;
+  cfg.snr_db = 20.0;
+  cfg.on_ms = 60;
+  cfg.off_ms = 60;
+  cfg.seed = 1;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-c") && i + 1 < argc)
+      cfg.channels = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-s") && i + 1 < argc)
+      cfg.seconds = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      cfg.rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--snr") && i + 1 < argc)
+      cfg.snr_db = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--on") && i + 1 < argc)
+      cfg.on_ms = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--off") && i + 1 < argc)
+      cfg.off_ms = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--seed") && i + 1 < argc)
+      cfg.seed = strtoul(argv[++i], NULL, 0);
+    else {
+      fprintf(stderr, "usage: %s [-c channels] [-s seconds] [-r rate] [--snr dB] [--on ms] [--off ms] [--seed n]\n",
+	      argv[0]);
+      return 2;
+    }
+  }
+  if(cfg.channels < 1 || cfg.seconds <= 0 || cfg.rate <= 0 || cfg.seed == 0) {
+    fprintf(stderr, "channels, seconds, rate and seed must be positive\n");
+    return 2;
+  }
+
+  on = (uint32_t)(cfg.on_ms * cfg.rate / 1000);
+  period = on + (uint32_t)(cfg.off_ms * cfg.rate / 1000);
+  lead = (uint32_t)(LEAD_IN_MS * cfg.rate / 1000);
+  total = (uint32_t)(cfg.seconds * cfg.rate);
+  per_channel = total > lead + period ? (total - lead - period) / period : 0;
+  // Noise against the power of one tone, as in loopback_bench
+  noise_sigma = sqrt(TONE_LEVEL * TONE_LEVEL / 2.0 / pow(10.0, cfg.snr_db / 10.0));
+
+  if(init_goertzel_bank(&bank, cfg.channels, cfg.rate) < 0) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  frame = malloc(BUFFER_COUNT * cfg.channels * sizeof(int16_t));
+  ch = calloc(cfg.channels, sizeof(channel_t));
+  matched = calloc((size_t)cfg.channels * (per_channel + 1), 1);
+  segmenters = malloc(cfg.channels * sizeof(segmenter_t));
+  if(!frame || !ch || !matched || !segmenters) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  init_event_ring(&events);
+  rng_state = cfg.seed;
+  for(c = 0; c < cfg.channels; c++) {
+    init_segmenter(&segmenters[c], &events, 0, cfg.rate, bank.block_length);
+    ch[c].offset = lead + rng_next() % period;
+    ch[c].current = -1;
+  }
+
+  for(sample = 0; sample < total; sample += n) {
+    n = total - sample < BUFFER_COUNT ? total - sample : BUFFER_COUNT;
+
+    // Render one frame, channel-interleaved
+    for(c = 0; c < cfg.channels; c++) {
+      channel_t *p = &ch[c];
+
+      for(t = 0; t < n; t++) {
+	s = sample + t;
+	v = (float)noise_sigma * rng_noise();
+	index = s >= p->offset ? (int)((s - p->offset) / period) : -1;
+
+	if(index >= 0 && index < per_channel && (s - p->offset) % period < on) {
+	  if(index != p->current) {
+	    key = strchr(keypad, digit_of(&cfg, c, index)) - keypad;
+	    p->low_step = (float)(2.0 * MYPI * dtfm_tone_freqs[key / DTFM_NUM_COLS] / cfg.rate);
+	    p->high_step = (float)(2.0 * MYPI * dtfm_tone_freqs[DTFM_NUM_ROWS + key % DTFM_NUM_COLS] / cfg.rate);
+	    p->current = index;
+	  }
+	  v += TONE_LEVEL * (sinf(p->low_phase) + sinf(p->high_phase));
+	  p->low_phase = fmodf(p->low_phase + p->low_step, (float)(2.0 * MYPI));
+	  p->high_phase = fmodf(p->high_phase + p->high_step, (float)(2.0 * MYPI));
+	}
+
+	frame[t * cfg.channels + c] = (int16_t)(v > 32767.0f ? 32767.0f : v < -32768.0f ? -32768.0f : v);
+      }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for(done = 0; done < n; ) {
+      done += goertzel_bank_write(&bank, frame + done * cfg.channels, n - done);
+      if(goertzel_bank_block_ready(&bank)) {
+	goertzel_bank_classify(&bank);
+
+	// Time stamp each reading with the centre of its block
+	stamp = sample + done - bank.block_length / 2;
+	for(c = 0; c < cfg.channels; c++) {
+	  segmenter_update(&segmenters[c], bank.detected[c], stamp);
+
+	  // At most one digit ends per update, so the ring never fills.
+	  // The middle of a digit falls inside its own on/off period.
+	  while(event_ring_pop(&events, &event)) {
+	    mid = event.start_sample + (event.end_sample - event.start_sample) / 2;
+	    index = mid >= ch[c].offset ? (int)((mid - ch[c].offset) / period) : -1;
+	    if(index >= 0 && index < per_channel && !matched[c * (per_channel + 1) + index] &&
+	       digit_of(&cfg, c, index) == event.digit) {
+	      matched[c * (per_channel + 1) + index] = 1;
+	      hits++;
+	    }
+	    else {
+	      false_digits++;
+	    }
+	  }
+	}
+      }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    decode_time += elapsed_seconds(&t0, &t1);
+  }
+
+  expected = (uint64_t)cfg.channels * per_channel;
+  audio = total / cfg.rate;
+
+  printf("# kernel %s, %d channels, %.1f s at %.0f Hz, block %d, %.0f dB SNR, %d/%d ms on/off\n",
+	 goertzel_bank_kernel(), cfg.channels, audio, cfg.rate, bank.block_length,
+	 cfg.snr_db, cfg.on_ms, cfg.off_ms);
+  printf("# digits   hits   miss  false   decode_s  x_rtime  channels_per_core\n");
+  printf("%8llu %6llu %6llu %6llu %10.3f %8.1f %18.0f\n",
+	 (unsigned long long)expected, (unsigned long long)hits,
+	 (unsigned long long)(expected - hits), (unsigned long long)false_digits,
+	 decode_time, audio / decode_time, cfg.channels * audio / decode_time);
+
+  free_goertzel_bank(&bank);
+  free(frame);
+  free(ch);
+  free(matched);
+  free(segmenters);
+  return 0;
+}
@@ -0,0 +1,336 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: loopback_bench.c
+//
+// Synopsis: Host benchmark of the encoder -> decoder chain. Random
+//           digits are rendered through the encoder's sine_wave
+//           tables, impaired with noise, twist and frequency error,
+//           and fed block by block through the same decoder_process the
+//           board runs under ProcessBuffer. Prints one scorecard line
+//           per SNR: detector latency, digit hits, misses and false
+//           digits, decoding throughput, and the share of hops the
+//           energy gate kept from the FFT.
+//
+// Usage:    loopback_bench [-r rate] [-d digits] [--on ms] [--off ms]
+//                          [--snr list] [--twist dB] [--ferr percent]
+//                          [--block samples] [--seed n] [--histogram]
+//                          [--silence ms] [--lead-in ms]
+//
+//           --snr takes a comma separated list of SNRs in dB (signal
+//           power of both tones over noise power). Twist is the high
+//           group level relative to the low group. --ferr moves the
+//           low group tone down and the high group tone up by that
+//           much (a negative value the other way), the worst case
+//           for the ratio of the two; Q.24 allows 1.5. --silence starts
+//           the run with digital silence, as muted lines and many
+//           recordings do, before the noise comes in. --lead-in sets
+//           the time before the first digit; 0 starts the stream on a
+//           tone. Results depend
+//           only on the arguments and the decoder build.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "config.h"
+#include "frames.h"
+#include "fft.h"
+#include "dtfm.h"
+#include "waveforms.h"
+#include "events.h"
+#include "arena.h"
+#include "decoder.h"
+
+#define TONE_LEVEL		6000.0	// low group amplitude in ADC counts
+#define LEAD_IN_MS		200	// noise before the first digit and after the last
+#define MAX_BLOCK		4096
+#define HISTOGRAM_MS		5
+#define HISTOGRAM_BINS		20
+
+static const char keypad[] = "123A456B789C*0#D";
+
+typedef struct {
+  char digit;
+  uint32_t start, end;		// sample numbers, end exclusive
+  int detected;			// detected_char showed the digit
+  int matched;			// a digit event was matched to it
+} truth_t;
+
+typedef struct {
+  double rate;
+  int digits;
+  int on_ms, off_ms;
+  double twist_db;
+  double ferr_percent;
+  int block;
+  uint32_t seed;
+  int histogram;
+  int silence_ms;
+  int lead_in_ms;
+} bench_config_t;
+
+static COMPLEX twiddle_factors[FFT_LENGTH];
+static decoder_t decoder;
+static double decoder_memory[DECODER_ARENA_BYTES / sizeof(double) + 1];
+
+static uint32_t rng_state;
+
+static uint32_t rng_next(void)
+{
+  // xorshift32, so runs are identical on every host
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+static double rng_gaussian(void)
+{
+  double u1 = (rng_next() + 1.0) / 4294967297.0;
+  double u2 = (rng_next() + 1.0) / 4294967297.0;
+
+  return sqrt(-2.0 * log(u1)) * cos(2.0 * MYPI * u2);
+}
+
+static int compare_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+static double percentile(const double *sorted, int n, double p)
+{
+  int i;
+
+  if(n == 0)
+    return 0.0;
+  i = (int)(p * (n - 1) + 0.5);
+  return sorted[i];
+}
+
+static void match_events(truth_t *truth, int digits, uint32_t off, int *hits, int *false_digits)
+{
+  digit_event_t event;
+  int i, found;
+
+  // The ring is small, so this runs after every block
+  while(event_ring_pop(&decoder.events, &event)) {
+    if(event.channel != 0)
+      continue;
+    found = 0;
+    for(i = 0; i < digits && !found; i++) {
+      if(!truth[i].matched && truth[i].digit == event.digit &&
+	 event.start_sample < truth[i].end + off && event.end_sample > truth[i].start) {
+	truth[i].matched = 1;
+	found = 1;
+      }
+    }
+    if(found)
+      (*hits)++;
+    else
+      (*false_digits)++;
+  }
+}
+
+static double elapsed_seconds(const struct timespec *a, const struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) + (b->tv_nsec - a->tv_nsec) * 1e-9;
+}
+
+static void run_snr(const bench_config_t *cfg, double snr_db)
+{
+  static int16_t block[2 * MAX_BLOCK];
+  truth_t *truth = calloc(cfg->digits, sizeof(truth_t));
+  double *latency = malloc(cfg->digits * sizeof(double));
+  int histogram[HISTOGRAM_BINS + 1] = { 0 };
+  uint32_t on = (uint32_t)(cfg->on_ms * cfg->rate / 1000);
+  uint32_t off = (uint32_t)(cfg->off_ms * cfg->rate / 1000);
+  uint32_t silence = (uint32_t)(cfg->silence_ms * cfg->rate / 1000);
+  uint32_t total, sample, n, t;
+  double low_level = TONE_LEVEL;
+  double high_level = TONE_LEVEL * pow(10.0, cfg->twist_db / 20.0);
+  double noise_sigma, low_index = 0, high_index = 0, low_step = 0, high_step = 0;
+  double decode_time = 0.0, gated = 0.0, v;
+  int i, key, current = 0, num_latency = 0, hits = 0, false_digits = 0, raw_misses = 0;
+  struct timespec t0, t1;
+
+  // Noise against the mean power of the two tones
+  noise_sigma = sqrt((low_level * low_level + high_level * high_level) / 2.0 / pow(10.0, snr_db / 10.0));
+
+  rng_state = cfg->seed;
+  sample = silence + (uint32_t)(cfg->lead_in_ms * cfg->rate / 1000);
+  for(i = 0; i < cfg->digits; i++) {
+    truth[i].digit = keypad[rng_next() % 16];
+    truth[i].start = sample;
+    truth[i].end = sample + on;
+    sample += on + off;
+  }
+  total = sample + (uint32_t)(LEAD_IN_MS * cfg->rate / 1000);
+
+  decoder_reset(&decoder, cfg->rate);
+
+  for(sample = 0; sample < total; sample += n) {
+    n = total - sample < (uint32_t)cfg->block ? total - sample : (uint32_t)cfg->block;
+
+    // Render the block through the encoder's tables
+    for(t = 0; t < n; t++) {
+      uint32_t s = sample + t;
+
+      while(current < cfg->digits && s >= truth[current].end)
+	current++;
+
+      v = s < silence ? 0.0 : noise_sigma * rng_gaussian();
+      if(current < cfg->digits && s >= truth[current].start) {
+	if(s == truth[current].start) {
+	  key = strchr(keypad, truth[current].digit) - keypad;
+	  low_step = dtfm_tone_freqs[key / DTFM_NUM_COLS] * (1.0 - cfg->ferr_percent / 100.0) *
+	    MAX_WAVEFORM_INDEX / cfg->rate;
+	  high_step = dtfm_tone_freqs[DTFM_NUM_ROWS + key % DTFM_NUM_COLS] * (1.0 + cfg->ferr_percent / 100.0) *
+	    MAX_WAVEFORM_INDEX / cfg->rate;
+	}
+	v += low_level * sine_wave((float)low_index) + high_level * sine_wave((float)high_index);
+	low_index = fmod(low_index + low_step, MAX_WAVEFORM_INDEX);
+	high_index = fmod(high_index + high_step, MAX_WAVEFORM_INDEX);
+      }
+
+      if(v > 32767.0)
+	v = 32767.0;
+      if(v < -32768.0)
+	v = -32768.0;
+      block[2*t] = (int16_t)v;
+      block[2*t + 1] = (int16_t)v;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    decoder_process(&decoder, block, n, twiddle_factors);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    decode_time += elapsed_seconds(&t0, &t1);
+
+    // First time the detector shows a digit, from the tone's start
+    for(i = current > 0 ? current - 1 : 0; i <= current && i < cfg->digits; i++) {
+      if(!truth[i].detected && decoder.detected_char[0] == truth[i].digit &&
+	 sample + n > truth[i].start && sample + n <= truth[i].end + off) {
+	truth[i].detected = 1;
+	latency[num_latency++] = (sample + n - truth[i].start) * 1000.0 / cfg->rate;
+      }
+    }
+
+    match_events(truth, cfg->digits, off, &hits, &false_digits);
+  }
+
+  for(i = 0; i < cfg->digits; i++)
+    raw_misses += !truth[i].detected;
+
+  qsort(latency, num_latency, sizeof(double), compare_double);
+  for(i = 0; i < num_latency; i++) {
+    int bin = (int)(latency[i] / HISTOGRAM_MS);
+    histogram[bin < HISTOGRAM_BINS ? bin : HISTOGRAM_BINS]++;
+  }
+
+#if DETECTOR == DETECTOR_STFT
+  gated = decoder.stft.hops ? 100.0 * decoder.stft.hops_gated / decoder.stft.hops : 0.0;
+#endif
+
+  printf("%6.1f %6.1f %6.2f %6d %6d %6d %6d %6d %7.1f %7.1f %7.1f %7.1f %10.0f %8.0f %6.1f\n",
+	 snr_db, cfg->twist_db, cfg->ferr_percent, cfg->digits, hits, cfg->digits - hits,
+	 false_digits, raw_misses,
+	 percentile(latency, num_latency, 0.0), percentile(latency, num_latency, 0.5),
+	 percentile(latency, num_latency, 0.9), percentile(latency, num_latency, 1.0),
+	 decode_time > 0 ? total / (double)BUFFER_COUNT / decode_time : 0.0,
+	 decode_time > 0 ? total / cfg->rate / decode_time : 0.0, gated);
+
+  if(cfg->histogram) {
+    for(i = 0; i <= HISTOGRAM_BINS; i++) {
+      if(histogram[i] == 0)
+	continue;
+      if(i < HISTOGRAM_BINS)
+	printf("        %3d-%3d ms %6d\n", i * HISTOGRAM_MS, (i + 1) * HISTOGRAM_MS, histogram[i]);
+      else
+	printf("        >=%5d ms %6d\n", i * HISTOGRAM_MS, histogram[i]);
+    }
+  }
+
+  free(truth);
+  free(latency);
+}
+
+int main(int argc, char *argv[])
+{
+  bench_config_t cfg;
+  const char *snr_list = "40,20,10,6,3,0";
+  char *list, *item;
+  arena_t arena;
+  int i;
+
+  cfg.rate = SAMPLING_FREQUENCY;
+  cfg.digits = 200;
+  cfg.on_ms = 60;
+  cfg.off_ms = 60;
+  cfg.twist_db = 0.0;
+  cfg.ferr_percent = 0.0;
+  cfg.block = ANALYSIS_HOP;
+  cfg.seed = 1;
+  cfg.histogram = 0;
+  cfg.silence_ms = 0;
+  cfg.lead_in_ms = LEAD_IN_MS;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      cfg.rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-d") && i + 1 < argc)
+      cfg.digits = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--on") && i + 1 < argc)
+      cfg.on_ms = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--off") && i + 1 < argc)
+      cfg.off_ms = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--snr") && i + 1 < argc)
+      snr_list = argv[++i];
+    else if(!strcmp(argv[i], "--twist") && i + 1 < argc)
+      cfg.twist_db = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--ferr") && i + 1 < argc)
+      cfg.ferr_percent = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--block") && i + 1 < argc)
+      cfg.block = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--seed") && i + 1 < argc)
+      cfg.seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "--histogram"))
+      cfg.histogram = 1;
+    else if(!strcmp(argv[i], "--silence") && i + 1 < argc)
+      cfg.silence_ms = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--lead-in") && i + 1 < argc)
+      cfg.lead_in_ms = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s [-r rate] [-d digits] [--on ms] [--off ms] [--snr list] [--twist dB]\n"
+	      "       [--ferr percent] [--block samples] [--seed n] [--histogram] [--silence ms]\n"
+	      "       [--lead-in ms]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if(cfg.block < 1 || cfg.block > MAX_BLOCK || cfg.digits < 1 || cfg.seed == 0 ||
+     cfg.silence_ms < 0 || cfg.lead_in_ms < 0) {
+    fprintf(stderr, "block must be 1..%d, digits and seed non-zero, silence and lead-in not negative\n", MAX_BLOCK);
+    return 2;
+  }
+
+  init_W(FFT_LENGTH, twiddle_factors);
+  init_arena(&arena, decoder_memory, sizeof(decoder_memory));
+  init_decoder(&decoder, &arena, cfg.rate);
+
+  printf("# detector %s, FFT_LENGTH %d, hop %d, rate %.0f Hz, block %d, %d/%d ms on/off, seed %u\n",
+	 DETECTOR == DETECTOR_SDFT ? "sdft" : "stft", FFT_LENGTH, ANALYSIS_HOP, cfg.rate, cfg.block,
+	 cfg.on_ms, cfg.off_ms, cfg.seed);
+  printf("#  snr  twist   ferr digits   hits   miss  false rawmiss  lat_min lat_p50 lat_p90 lat_max"
+	 "   frames/s  x_rtime  gated\n");
+
+  list = malloc(strlen(snr_list) + 1);
+  strcpy(list, snr_list);
+  for(item = strtok(list, ","); item; item = strtok(NULL, ","))
+    run_snr(&cfg, atof(item));
+  free(list);
+
+  return 0;
+}
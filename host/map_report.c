@@ -0,0 +1,270 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: map_report.c
+//
+// Synopsis: Host tool that summarises the linker map of a board build
+//           (Debug/EGR423_Lab10.map): how full each memory range is,
+//           and which output sections and objects fill it. Used to
+//           check where MEMORY_PLACEMENT put the decoder's working set
+//           (see appendix_a/placement.h), and that the real-time code
+//           and data fit the L1 caches.
+//
+// Usage:    map_report [-v] [-s section] file.map
+//
+//           -v lists the input sections of every output section;
+//           -s does so for the named output section only (repeatable).
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_MEMORIES	16
+#define MAX_SECTIONS	128
+#define MAX_INPUTS	1024
+#define MAX_SELECTED	16
+#define NAME_LENGTH	64
+
+// Sections that should fit the 32 KB L1 caches (see placement.h)
+static const struct {
+  const char *section, *cache;
+  unsigned long bytes;
+} cache_fit[] = {
+  { ".text:rt", "L1P", 32768 },
+  { "L2RAM", "L1D", 32768 },
+};
+
+typedef struct {
+  char name[NAME_LENGTH];
+  unsigned long origin, length, used;
+} memory_t;
+
+typedef struct {
+  char name[NAME_LENGTH];
+  unsigned long origin, length;
+  int memory;			// index into memories, -1 if outside all
+  int first_input, num_inputs;
+} section_t;
+
+typedef struct {
+  char name[2 * NAME_LENGTH];	// "file (section)"
+  unsigned long length;
+} input_t;
+
+static memory_t memories[MAX_MEMORIES];
+static section_t sections[MAX_SECTIONS];
+static input_t inputs[MAX_INPUTS];
+static int num_memories, num_sections, num_inputs;
+
+static int is_hex(const char *s)
+{
+  if(!*s)
+    return 0;
+  for(; *s; s++)
+    if(!isxdigit((unsigned char)*s))
+      return 0;
+  return 1;
+}
+
+static int find_memory(unsigned long address)
+{
+  int i;
+
+  for(i = 0; i < num_memories; i++)
+    if(address >= memories[i].origin && address - memories[i].origin < memories[i].length)
+      return i;
+  return -1;
+}
+
+static void parse_memory_line(const char *line)
+{
+  char name[NAME_LENGTH], origin[16], length[16], used[16];
+  memory_t *m;
+
+  if(num_memories == MAX_MEMORIES ||
+     sscanf(line, " %63s %15s %15s %15s", name, origin, length, used) != 4 ||
+     !is_hex(origin) || !is_hex(length) || !is_hex(used))
+    return;
+
+  m = &memories[num_memories++];
+  strcpy(m->name, name);
+  m->origin = strtoul(origin, NULL, 16);
+  m->length = strtoul(length, NULL, 16);
+  m->used = strtoul(used, NULL, 16);
+}
+
+static void parse_section_line(const char *line, char *pending)
+{
+  char token[5][NAME_LENGTH];
+  const char *rest;
+  section_t *s;
+  input_t *in;
+  int n, first;
+
+  n = sscanf(line, "%63s %63s %63s %63s %63s", token[0], token[1], token[2], token[3], token[4]);
+  if(n < 1)
+    return;
+
+  if(isspace((unsigned char)line[0])) {
+    // Input section: "  origin length file (section)"
+    if(n < 3 || !is_hex(token[0]) || !is_hex(token[1]) || !num_sections ||
+       num_inputs == MAX_INPUTS)
+      return;
+    rest = strstr(line, token[1]) + strlen(token[1]);
+    while(isspace((unsigned char)*rest))
+      rest++;
+    in = &inputs[num_inputs++];
+    snprintf(in->name, sizeof(in->name), "%.*s", (int)strcspn(rest, "\r\n"), rest);
+    in->length = strtoul(token[1], NULL, 16);
+    sections[num_sections - 1].num_inputs++;
+    return;
+  }
+  else if(line[0] == '*' && pending[0]) {
+    // Numbers of an output section whose name was too long for its line
+    line++;
+  }
+  else if(n == 1) {
+    strcpy(pending, token[0]);
+    return;
+  }
+  else {
+    strcpy(pending, token[0]);
+    line += strlen(token[0]);
+  }
+
+  // Output section: "name [page] origin length [attributes]"
+  n = sscanf(line, "%63s %63s %63s", token[0], token[1], token[2]);
+  first = n == 3 && strlen(token[0]) == 1 && is_hex(token[2]) ? 1 : 0;
+  if(n < first + 2 || !is_hex(token[first]) || !is_hex(token[first + 1]) ||
+     num_sections == MAX_SECTIONS) {
+    pending[0] = '\0';
+    return;
+  }
+
+  s = &sections[num_sections++];
+  strcpy(s->name, pending);
+  s->origin = strtoul(token[first], NULL, 16);
+  s->length = strtoul(token[first + 1], NULL, 16);
+  s->memory = find_memory(s->origin);
+  s->first_input = num_inputs;
+  s->num_inputs = 0;
+  pending[0] = '\0';
+}
+
+static int read_map(FILE *in)
+{
+  enum { NONE, MEMORY, SECTIONS } part = NONE;
+  char line[512], pending[NAME_LENGTH] = "";
+
+  while(fgets(line, sizeof(line), in)) {
+    if(strstr(line, "MEMORY CONFIGURATION"))
+      part = MEMORY;
+    else if(strstr(line, "SEGMENT ALLOCATION MAP"))
+      part = NONE;
+    else if(strstr(line, "SECTION ALLOCATION MAP"))
+      part = SECTIONS;
+    else if(strstr(line, "GLOBAL SYMBOLS"))
+      break;
+    else if(part == MEMORY)
+      parse_memory_line(line);
+    else if(part == SECTIONS && line[0] != '-')
+      parse_section_line(line, pending);
+  }
+
+  return num_memories > 0 && num_sections > 0;
+}
+
+static int selected(const char *name, char **names, int count)
+{
+  int i;
+
+  for(i = 0; i < count; i++)
+    if(!strcmp(name, names[i]))
+      return 1;
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  char *select[MAX_SELECTED];
+  const char *path = NULL;
+  int i, j, m, verbose = 0, num_select = 0;
+  unsigned long total;
+  FILE *in;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-v"))
+      verbose = 1;
+    else if(!strcmp(argv[i], "-s") && i + 1 < argc && num_select < MAX_SELECTED)
+      select[num_select++] = argv[++i];
+    else if(argv[i][0] != '-' && !path)
+      path = argv[i];
+    else
+      path = NULL, i = argc;
+  }
+  if(!path) {
+    fprintf(stderr, "usage: %s [-v] [-s section] file.map\n", argv[0]);
+    return 2;
+  }
+
+  in = fopen(path, "r");
+  if(!in) {
+    perror(path);
+    return 1;
+  }
+  if(!read_map(in)) {
+    fprintf(stderr, "%s: no memory configuration or section map found\n", path);
+    fclose(in);
+    return 1;
+  }
+  fclose(in);
+
+  printf("%-12s %10s %10s %10s %10s %6s\n", "memory", "origin", "length", "used", "free", "used%");
+  for(m = 0; m < num_memories; m++)
+    printf("%-12s 0x%08lx %10lu %10lu %10lu %5.1f%%\n", memories[m].name, memories[m].origin,
+	   memories[m].length, memories[m].used, memories[m].length - memories[m].used,
+	   memories[m].length ? 100.0 * memories[m].used / memories[m].length : 0.0);
+
+  // Real-time code and data against the L1 caches they run from
+  for(i = 0; i < (int)(sizeof(cache_fit) / sizeof(cache_fit[0])); i++)
+    for(j = 0; j < num_sections; j++)
+      if(!strcmp(sections[j].name, cache_fit[i].section)) {
+	printf("%s%-12s %10lu bytes, %5.1f%% of the %lu KB %s%s\n", i ? "" : "\n", sections[j].name,
+	       sections[j].length, 100.0 * sections[j].length / cache_fit[i].bytes,
+	       cache_fit[i].bytes >> 10, cache_fit[i].cache,
+	       sections[j].length > cache_fit[i].bytes ? " - does not fit, will thrash" : "");
+	break;
+      }
+
+  // Sections grouped by the memory they landed in
+  for(m = -1; m < num_memories; m++) {
+    total = 0;
+    for(j = 0; j < num_sections; j++)
+      if(sections[j].memory == m && sections[j].length)
+	total++;
+    if(!total)
+      continue;
+
+    printf("\n%-20s %10s %10s %7s\n", m < 0 ? "(no memory)" : memories[m].name, "origin", "bytes",
+	   "share");
+    total = 0;
+    for(j = 0; j < num_sections; j++) {
+      section_t *s = &sections[j];
+
+      if(s->memory != m || !s->length)
+	continue;
+      total += s->length;
+      printf("  %-18s 0x%08lx %10lu %6.1f%%\n", s->name, s->origin, s->length,
+	     m >= 0 && memories[m].length ? 100.0 * s->length / memories[m].length : 0.0);
+
+      if(verbose || selected(s->name, select, num_select))
+	for(i = s->first_input; i < s->first_input + s->num_inputs; i++)
+	  if(inputs[i].length)
+	    printf("      %10lu  %s\n", inputs[i].length, inputs[i].name);
+    }
+    printf("  %-18s %10s %10lu\n", "total", "", total);
+  }
+
+  return 0;
+}
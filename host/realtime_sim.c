@@ -0,0 +1,315 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: realtime_sim.c
+//
+// Synopsis: Runs the decoder against a recording at the EDMA frame
+//           cadence, as the board's main loop does. A timer thread
+//           stands in for EDMA_ISR: every BUFFER_COUNT samples' worth
+//           of time it fills the next of three frames and marks it
+//           ready, counting an over_run if the last one was not done.
+//           The main thread sleeps on a condition variable until then
+//           (WaitForBuffer's IDLE) and decodes the frame, cpu_load
+//           splits the wall-clock time into idle and busy, and the
+//           deadline monitor scores each frame against the period.
+//
+// Usage:    realtime_sim [-x speed] [-l ns] [-j uniform|exp -J ns]
+//                        [--sweep] [-f frames] [-r rate] [-c channels] file
+//
+//           -x runs the clock speed times faster than real time, to
+//           find how far the decoder is from missing frames on this
+//           machine. -l burns a fixed synthetic load after each frame,
+//           -j/-J add random jitter to it. --sweep raises the load in
+//           steps of 1/LOAD_SWEEP_STEPS of the frame period, -f frames
+//           each (default LOAD_SWEEP_FRAMES), looping the file, until a
+//           frame is missed, and prints the budget that was sustained.
+//           -r and -c describe raw files, as for wav_decode.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include "config.h"
+#include "frames.h"
+#include "fft.h"
+#include "events.h"
+#include "arena.h"
+#include "decoder.h"
+#include "cpu_load.h"
+#include "deadline.h"
+#include "load_inject.h"
+#include "audio_file.h"
+
+typedef struct {
+  const audio_file_t *audio;
+  uint64_t period_ns;		// time between frames on the simulated clock
+  uint64_t done;		// sample frames handed out so far
+  uint64_t length;		// file plus trailing silence, looped while sweeping
+  int16_t buffer[NUM_BUFFERS][BUFFER_LENGTH];
+  int ready_index;
+  int buffer_ready;
+  int finished;			// no more frames will be posted
+  int sweeping;			// keep posting past the end
+  uint32_t frames;
+  pthread_mutex_t lock;
+  pthread_cond_t ready;
+} edma_sim_t;
+
+static COMPLEX twiddle_factors[FFT_LENGTH];
+static decoder_t decoder;
+static double decoder_memory[DECODER_ARENA_BYTES / sizeof(double) + 1];
+static cpu_load_t cpu_load;
+static deadline_t frame_deadline;
+static load_inject_t frame_load;
+
+static uint16_t get_u16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint64_t now_ns(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+static uint32_t load_clock(void)
+{
+  return (uint32_t)now_ns();
+}
+
+static void fill_frame(edma_sim_t *sim, int16_t *frame)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Copies the next BUFFER_COUNT sample frames of the file
+//            into a frame laid out as the McASP writes it (L, R)
+//
+// Input:     sim - simulation state, advanced by one frame
+//            frame - BUFFER_LENGTH samples to fill
+//
+// Returns:   Nothing
+//
+// Calls:     Nothing
+//
+// Notes:     Mono files go to both channels; past the end is silence
+///////////////////////////////////////////////////////////////////////
+{
+  const audio_file_t *audio = sim->audio;
+  const uint8_t *p;
+  uint64_t position;
+  int i;
+
+  for(i = 0; i < BUFFER_COUNT; i++, sim->done++) {
+    position = sim->done % sim->length;
+    if(position < audio->frames) {
+      p = audio->data + 2 * audio->channels * position;
+      frame[2*i] = (int16_t)get_u16(p);
+      frame[2*i + 1] = (int16_t)get_u16(p + 2 * (audio->channels - 1));
+    }
+    else {
+      frame[2*i] = frame[2*i + 1] = 0;
+    }
+  }
+}
+
+static void *edma_thread(void *context)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Posts one frame per frame period, as EDMA_ISR does
+//
+// Input:     context - the edma_sim_t
+//
+// Returns:   NULL
+//
+// Calls:     fill_frame, deadline_isr
+//
+// Notes:     Deadlines are absolute, so a late wake-up does not move
+//            the frames after it. One second of silence follows the
+//            file so a final digit can end. While a sweep runs the
+//            file is played again from the start.
+///////////////////////////////////////////////////////////////////////
+{
+  edma_sim_t *sim = context;
+  uint64_t deadline = now_ns();
+  struct timespec t;
+  int next, more = 1;
+
+  while(more) {
+    deadline += sim->period_ns;
+    t.tv_sec = deadline / 1000000000u;
+    t.tv_nsec = deadline % 1000000000u;
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL))
+      ;
+
+    // The EDMA fills the frame behind the one being processed
+    next = sim->ready_index + 1 < NUM_BUFFERS ? sim->ready_index + 1 : 0;
+    fill_frame(sim, sim->buffer[next]);
+
+    pthread_mutex_lock(&sim->lock);
+    sim->ready_index = next;
+    deadline_isr(&frame_deadline, (uint32_t)now_ns(), sim->buffer_ready);
+    sim->buffer_ready = 1;
+    sim->frames++;
+    more = sim->done < sim->length || sim->sweeping;
+    pthread_cond_signal(&sim->ready);
+    pthread_mutex_unlock(&sim->lock);
+  }
+
+  pthread_mutex_lock(&sim->lock);
+  sim->finished = 1;
+  pthread_cond_signal(&sim->ready);
+  pthread_mutex_unlock(&sim->lock);
+  return NULL;
+}
+
+static int wait_for_buffer(edma_sim_t *sim)
+///////////////////////////////////////////////////////////////////////
+// Purpose:   Sleeps until a frame is ready, as WaitForBuffer does
+//
+// Input:     sim - simulation state
+//
+// Returns:   Index of the ready frame, -1 once the EDMA has stopped
+//
+// Calls:     cpu_load_idle, cpu_load_frame
+//
+// Notes:     Time spent blocked counts as idle, the rest as busy
+///////////////////////////////////////////////////////////////////////
+{
+  uint64_t start;
+  int index;
+
+  pthread_mutex_lock(&sim->lock);
+  while(!sim->buffer_ready && !sim->finished) {
+    start = now_ns();
+    pthread_cond_wait(&sim->ready, &sim->lock);
+    cpu_load_idle(&cpu_load, (uint32_t)(now_ns() - start));
+  }
+  index = sim->buffer_ready ? sim->ready_index : -1;
+  pthread_mutex_unlock(&sim->lock);
+
+  if(index >= 0)
+    cpu_load_frame(&cpu_load, (uint32_t)now_ns());
+  return index;
+}
+
+int main(int argc, char *argv[])
+{
+  static edma_sim_t sim;
+  const char *path = NULL;
+  audio_file_t audio;
+  digit_event_t event;
+  arena_t arena;
+  pthread_t edma;
+  double speed = 1.0, raw_rate = SAMPLING_FREQUENCY, load_ns = 0, jitter_ns = 0;
+  int i, index, raw_channels = 1, sweep = 0, step_frames = LOAD_SWEEP_FRAMES;
+  uint8_t jitter = LOAD_JITTER_NONE;
+  uint32_t on_time;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-x") && i + 1 < argc)
+      speed = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-l") && i + 1 < argc)
+      load_ns = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-j") && i + 1 < argc && !strcmp(argv[i + 1], "uniform"))
+      jitter = LOAD_JITTER_UNIFORM, i++;
+    else if(!strcmp(argv[i], "-j") && i + 1 < argc && !strcmp(argv[i + 1], "exp"))
+      jitter = LOAD_JITTER_EXPONENTIAL, i++;
+    else if(!strcmp(argv[i], "-J") && i + 1 < argc)
+      jitter_ns = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--sweep"))
+      sweep = 1;
+    else if(!strcmp(argv[i], "-f") && i + 1 < argc)
+      step_frames = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      raw_rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-c") && i + 1 < argc)
+      raw_channels = atoi(argv[++i]);
+    else if(argv[i][0] != '-' && !path)
+      path = argv[i];
+    else
+      path = NULL, i = argc;
+  }
+  if(!path || speed <= 0 || load_ns < 0 || jitter_ns < 0 || step_frames < 1 ||
+     raw_channels < 1 || raw_channels > 2 || raw_rate <= 0) {
+    fprintf(stderr, "usage: %s [-x speed] [-l ns] [-j uniform|exp -J ns] [--sweep] [-f frames]\n"
+	    "       [-r rate] [-c 1|2] file.wav|file.raw\n", argv[0]);
+    return 2;
+  }
+
+  if(open_audio(&audio, path, raw_rate, raw_channels) < 0)
+    return 1;
+
+  init_W(FFT_LENGTH, twiddle_factors);
+  init_arena(&arena, decoder_memory, sizeof(decoder_memory));
+  init_decoder(&decoder, &arena, audio.rate);
+
+  sim.audio = &audio;
+  sim.period_ns = (uint64_t)(1e9 * BUFFER_COUNT / audio.rate / speed);
+  sim.length = audio.frames + (uint64_t)audio.rate;
+  sim.sweeping = sweep;
+  pthread_mutex_init(&sim.lock, NULL);
+  pthread_cond_init(&sim.ready, NULL);
+  init_cpu_load(&cpu_load, (uint32_t)now_ns());
+  init_deadline(&frame_deadline, (uint32_t)sim.period_ns);
+  init_load_inject(&frame_load, load_clock, (uint32_t)load_ns, jitter, (uint32_t)jitter_ns);
+  if(sweep)
+    load_inject_sweep(&frame_load, (uint32_t)(sim.period_ns / LOAD_SWEEP_STEPS), step_frames, 0);
+  if(pthread_create(&edma, NULL, edma_thread, &sim)) {
+    fprintf(stderr, "cannot start the EDMA thread\n");
+    return 1;
+  }
+
+  // The board's main loop
+  while((index = wait_for_buffer(&sim)) >= 0) {
+    deadline_start(&frame_deadline, (uint32_t)now_ns());
+    decoder_process(&decoder, sim.buffer[index], BUFFER_COUNT, twiddle_factors);
+    deadline_zone(&frame_deadline, DEADLINE_ZONE_DECODE, (uint32_t)now_ns());
+    load_inject_frame(&frame_load, frame_deadline.over_runs);
+    deadline_zone(&frame_deadline, DEADLINE_ZONE_LOAD, (uint32_t)now_ns());
+    deadline_end(&frame_deadline, (uint32_t)now_ns());
+
+    pthread_mutex_lock(&sim.lock);
+    sim.buffer_ready = 0;
+    sim.sweeping = frame_load.sweep == LOAD_SWEEP_RUNNING;
+    pthread_mutex_unlock(&sim.lock);
+
+    // Digits repeat while the file loops; only the sweep result counts then
+    while(event_ring_pop(&decoder.events, &event))
+      if(!sweep)
+	putchar(event.digit);
+    fflush(stdout);
+  }
+  putchar('\n');
+  fflush(stdout);
+  pthread_join(edma, NULL);
+
+  fprintf(stderr, "%u frames of %.2f ms, %u over_runs, load last %u%% peak %u%% average %.1f%%\n",
+	  sim.frames, sim.period_ns * 1e-6, frame_deadline.over_runs, cpu_load.load_percent,
+	  cpu_load.peak_percent, cpu_load_average(&cpu_load) / 10.0);
+  fprintf(stderr, "%u late (longest run %u), least headroom %.1f%%, slowest frame %u: "
+	  "%.3f ms wake + %.3f ms decode + %.3f ms load\n", frame_deadline.late,
+	  frame_deadline.longest_run, 100.0 * frame_deadline.min_headroom / frame_deadline.period,
+	  frame_deadline.worst.frame, frame_deadline.worst.zone[DEADLINE_ZONE_WAKE] * 1e-6,
+	  frame_deadline.worst.zone[DEADLINE_ZONE_DECODE] * 1e-6,
+	  frame_deadline.worst.zone[DEADLINE_ZONE_LOAD] * 1e-6);
+
+  // Headroom histogram, most headroom first
+  on_time = frame_deadline.frames - frame_deadline.late;
+  for(i = DEADLINE_BINS - 1; i >= 0; i--)
+    if(frame_deadline.histogram[i])
+      fprintf(stderr, "  headroom %3d-%3d%% %8u %5.1f%%\n", 100 * i / DEADLINE_BINS,
+	      100 * (i + 1) / DEADLINE_BINS, frame_deadline.histogram[i],
+	      on_time ? 100.0 * frame_deadline.histogram[i] / on_time : 0.0);
+
+  if(sweep)
+    printf("%s fft %d hop %d: %.3f ms of %.3f ms per frame sustained (%.1f%%)\n",
+	   DETECTOR == DETECTOR_SDFT ? "sdft" : "stft", FFT_LENGTH, ANALYSIS_HOP,
+	   frame_load.sustained * 1e-6, sim.period_ns * 1e-6,
+	   100.0 * frame_load.sustained / sim.period_ns);
+
+  decoder_destroy(&decoder);
+  close_audio(&audio);
+  return frame_deadline.over_runs && !sweep ? 3 : 0;
+}
@@ -0,0 +1,321 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: telemetry_decode.c
+//
+// Synopsis: Host tool that decodes a captured UART2 telemetry stream
+//           (see appendix_a/telemetry.h) into CSV files, with the
+//           spectra optionally as a NumPy .npy array.
+//
+// Usage:    telemetry_decode [-o prefix] [-r rate] [-n fft_length] [--npy] [capture]
+//
+//           Reads stdin when no capture file is given. Writes
+//           prefix_digits.csv, prefix_peaks.csv, prefix_stats.csv,
+//           prefix_deadline.csv and prefix_spectrum.csv (or
+//           prefix_spectrum.npy plus prefix_spectrum_index.csv).
+//           Sample rate and FFT length are taken from stats frames
+//           once one has been seen.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "config.h"
+#include "telemetry.h"
+
+#define NPY_HEADER_BYTES 128
+
+typedef struct {
+  FILE *digits, *peaks, *stats, *deadline, *spectrum, *spectrum_index;
+  int npy;
+  long npy_rows;
+  int npy_bins;
+  double sample_rate;
+  double fft_length;
+  uint32_t rate_start_sample;	// sample number where sample_rate took effect
+  double rate_start_seconds;
+  unsigned long frames, crc_errors, skipped_bytes, sequence_gaps;
+  int last_sequence;
+} decoder_t;
+
+static uint16_t get_u16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static double log8_to_db(uint8_t code)
+{
+  // code = 8*log2(1 + |X|), so 20*log10|X| ~ code * 20*log10(2) / 8
+  return code * 0.752575;
+}
+
+static double sample_seconds(const decoder_t *d, uint32_t sample)
+{
+  return d->rate_start_seconds + ((double)sample - d->rate_start_sample) / d->sample_rate;
+}
+
+static FILE *open_output(const char *prefix, const char *suffix, const char *mode)
+{
+  char name[1024];
+  FILE *f;
+
+  snprintf(name, sizeof(name), "%s_%s", prefix, suffix);
+  f = fopen(name, mode);
+  if(!f) {
+    perror(name);
+    exit(1);
+  }
+  return f;
+}
+
+static void write_npy_header(decoder_t *d)
+{
+  char header[NPY_HEADER_BYTES];
+  int len;
+
+  memset(header, ' ', sizeof(header));
+  memcpy(header, "\x93NUMPY\x01\x00", 8);
+  header[8] = (NPY_HEADER_BYTES - 10) & 0xFF;
+  header[9] = (NPY_HEADER_BYTES - 10) >> 8;
+  len = snprintf(header + 10, NPY_HEADER_BYTES - 10,
+		 "{'descr': '|u1', 'fortran_order': False, 'shape': (%ld, %d), }",
+		 d->npy_rows, d->npy_bins);
+  header[10 + len] = ' ';
+  header[NPY_HEADER_BYTES - 1] = '\n';
+
+  fseek(d->spectrum, 0, SEEK_SET);
+  fwrite(header, 1, sizeof(header), d->spectrum);
+  fseek(d->spectrum, 0, SEEK_END);
+}
+
+static void handle_frame(decoder_t *d, uint8_t type, const uint8_t *p, uint16_t len)
+{
+  int i, count;
+
+  switch(type) {
+  case TELEM_TYPE_DIGIT:
+    if(len < TELEM_DIGIT_BYTES)
+      break;
+    fprintf(d->digits, "%u,%c,%u,%u,%.6f,%.6f,%u\n", p[0], p[1], get_u32(p + 4), get_u32(p + 8),
+	    sample_seconds(d, get_u32(p + 4)), sample_seconds(d, get_u32(p + 8)), p[2]);
+    break;
+
+  case TELEM_TYPE_PEAKS:
+    if(len < 6)
+      break;
+    count = p[5];
+    for(i = 0; i < count && 6 + 3*i + 3 <= len; i++) {
+      double bin = get_u16(p + 6 + 3*i) / 256.0;
+      if(bin == 0)
+	continue;
+      fprintf(d->peaks, "%u,%u,%d,%.3f,%.2f,%.1f\n", get_u32(p), p[4], i, bin,
+	      bin * d->sample_rate / d->fft_length, log8_to_db(p[6 + 3*i + 2]));
+    }
+    break;
+
+  case TELEM_TYPE_SPECTRUM:
+    if(len < 8 || p[5] != TELEM_SPECTRUM_LOG8)
+      break;
+    count = get_u16(p + 6);
+    if(8 + count > len)
+      break;
+    if(d->npy) {
+      if(d->npy_bins == 0)
+	d->npy_bins = count;
+      if(count != d->npy_bins)
+	break;		// a rectangular array needs a fixed bin count
+      fwrite(p + 8, 1, count, d->spectrum);
+      fprintf(d->spectrum_index, "%ld,%u,%u\n", d->npy_rows, get_u32(p), p[4]);
+      d->npy_rows++;
+    }
+    else {
+      fprintf(d->spectrum, "%u,%u", get_u32(p), p[4]);
+      for(i = 0; i < count; i++)
+	fprintf(d->spectrum, ",%.1f", log8_to_db(p[8 + i]));
+      fputc('\n', d->spectrum);
+    }
+    break;
+
+  case TELEM_TYPE_STATS:
+    if(len < TELEM_STATS_BYTES)
+      break;
+    // Sample numbers keep counting across a rate change; the board
+    // sends a stats frame at the first sample taken at the new rate
+    if(get_u32(p) != d->sample_rate) {
+      d->rate_start_seconds = sample_seconds(d, get_u32(p + 12));
+      d->rate_start_sample = get_u32(p + 12);
+      d->sample_rate = get_u32(p);
+    }
+    d->fft_length = get_u16(p + 4);
+    fprintf(d->stats, "%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%.1f,%u,%u,%.2f,%u,%u,%.1f,%s,%u,%u,%u,%.1f,%u,%u,%.1f\n", get_u32(p), get_u16(p + 4), get_u16(p + 6), p[8],
+	    get_u32(p + 12), get_u32(p + 16), get_u32(p + 20), get_u32(p + 24), get_u32(p + 28),
+	    get_u32(p + 32), get_u32(p + 36), get_u32(p + 40), get_u32(p + 44), get_u32(p + 48),
+	    get_u32(p + 40) ? 100.0 * get_u32(p + 44) / get_u32(p + 40) : 0.0,
+	    get_u32(p + 52), get_u32(p + 56),
+	    get_u32(p + 56) ? (double)get_u32(p + 52) / get_u32(p + 56) : 0.0,
+	    p[60], p[61], get_u16(p + 62) / 10.0, p[9] == DETECTOR_SDFT ? "sdft" : "stft", p[10],
+	    get_u32(p + 64), get_u32(p + 68),
+	    get_u32(p + 40) ? 100.0 * get_u32(p + 68) / get_u32(p + 40) : 0.0,
+	    get_u32(p + 72), get_u32(p + 76),
+	    get_u32(p + 72) ? 100.0 * get_u32(p + 76) / get_u32(p + 72) : 0.0);
+    break;
+
+  case TELEM_TYPE_DEADLINE:
+    if(len < TELEM_DEADLINE_BYTES || !get_u32(p + 4))
+      break;
+    fprintf(d->deadline, "%u,%.6f,%u,%u,%u,%u,%u,%.1f,%u,%.1f", get_u32(p),
+	    sample_seconds(d, get_u32(p)), get_u32(p + 4), get_u32(p + 8), get_u32(p + 12),
+	    get_u32(p + 16), get_u32(p + 20), 100.0 * (int32_t)get_u32(p + 24) / get_u32(p + 4),
+	    get_u32(p + 28), 100.0 * get_u32(p + 32) / get_u32(p + 4));
+    for(i = 0; i < DEADLINE_ZONES; i++)
+      fprintf(d->deadline, ",%u", get_u32(p + 36 + 4*i));
+    for(i = 0; i < DEADLINE_BINS; i++)
+      fprintf(d->deadline, ",%u", get_u32(p + 36 + 4*DEADLINE_ZONES + 4*i));
+    fputc('\n', d->deadline);
+    break;
+
+  default:
+    break;
+  }
+}
+
+static void decode_stream(decoder_t *d, FILE *in)
+{
+  static uint8_t buf[2 * (TELEM_MAX_PAYLOAD + TELEM_OVERHEAD)];
+  size_t fill = 0, pos, n;
+  uint16_t len;
+
+  while((n = fread(buf + fill, 1, sizeof(buf) - fill, in)) > 0 || fill >= TELEM_OVERHEAD) {
+    fill += n;
+    pos = 0;
+
+    while(fill - pos >= TELEM_OVERHEAD) {
+      if(buf[pos] != TELEM_SYNC0 || buf[pos + 1] != TELEM_SYNC1) {
+	pos++;
+	d->skipped_bytes++;
+	continue;
+      }
+
+      len = get_u16(buf + pos + 4);
+      if(len > TELEM_MAX_PAYLOAD) {		// not a real header
+	pos++;
+	d->skipped_bytes++;
+	continue;
+      }
+      if(fill - pos < (size_t)len + TELEM_OVERHEAD)
+	break;				// wait for the rest of the frame
+
+      if(telemetry_crc16(buf + pos + 2, TELEM_HEADER_BYTES - 2 + len) !=
+	 get_u16(buf + pos + TELEM_HEADER_BYTES + len)) {
+	d->crc_errors++;
+	pos++;
+	d->skipped_bytes++;
+	continue;
+      }
+
+      if(d->last_sequence >= 0 && buf[pos + 3] != ((d->last_sequence + 1) & 0xFF))
+	d->sequence_gaps++;
+      d->last_sequence = buf[pos + 3];
+
+      handle_frame(d, buf[pos + 2], buf + pos + TELEM_HEADER_BYTES, len);
+      d->frames++;
+      pos += len + TELEM_OVERHEAD;
+    }
+
+    memmove(buf, buf + pos, fill - pos);
+    fill -= pos;
+    if(n == 0)
+      break;			// end of input, leftover bytes are a partial frame
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  decoder_t d;
+  const char *prefix = "telemetry";
+  const char *capture = NULL;
+  FILE *in = stdin;
+  int i;
+
+  memset(&d, 0, sizeof(d));
+  d.sample_rate = 8000;
+  d.fft_length = 256;
+  d.last_sequence = -1;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-o") && i + 1 < argc)
+      prefix = argv[++i];
+    else if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      d.sample_rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-n") && i + 1 < argc)
+      d.fft_length = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--npy"))
+      d.npy = 1;
+    else if(argv[i][0] == '-') {
+      fprintf(stderr, "usage: %s [-o prefix] [-r rate] [-n fft_length] [--npy] [capture]\n", argv[0]);
+      return 2;
+    }
+    else
+      capture = argv[i];
+  }
+
+  if(capture) {
+    in = fopen(capture, "rb");
+    if(!in) {
+      perror(capture);
+      return 1;
+    }
+  }
+
+  d.digits = open_output(prefix, "digits.csv", "w");
+  d.peaks = open_output(prefix, "peaks.csv", "w");
+  d.stats = open_output(prefix, "stats.csv", "w");
+  fprintf(d.digits, "channel,digit,start_sample,end_sample,start_s,end_s,confidence\n");
+  fprintf(d.peaks, "sample,channel,rank,bin,frequency_hz,level_db\n");
+  fprintf(d.stats, "sample_rate,fft_length,hop,channels,sample_clock,frames,hop_cycles_last,"
+	  "hop_cycles_max,over_runs,uart_overflows,events_dropped,frame_period,frame_cycles_max,"
+	  "render_cycles_max,worst_load_percent,cache_off_cycles,cache_on_cycles,cache_speedup,"
+	  "load_percent,peak_load_percent,average_load_percent,detector,load_sweep,load_cycles,"
+	  "load_sustained,load_sustained_percent,hops,hops_gated,gated_percent\n");
+  d.deadline = open_output(prefix, "deadline.csv", "w");
+  fprintf(d.deadline, "sample,time_s,period,frames,late,over_runs,longest_late_run,"
+	  "min_headroom_percent,worst_frame,worst_percent,worst_wake,worst_decode,worst_render,"
+	  "worst_load");
+  for(i = 0; i < DEADLINE_BINS; i++)
+    fprintf(d.deadline, ",headroom_%d", 100 * i / DEADLINE_BINS);
+  fputc('\n', d.deadline);
+
+  if(d.npy) {
+    d.spectrum = open_output(prefix, "spectrum.npy", "wb+");
+    d.spectrum_index = open_output(prefix, "spectrum_index.csv", "w");
+    fprintf(d.spectrum_index, "row,sample,channel\n");
+    write_npy_header(&d);	// placeholder, rewritten with the final shape
+  }
+  else {
+    d.spectrum = open_output(prefix, "spectrum.csv", "w");
+    fprintf(d.spectrum, "sample,channel,level_db...\n");
+  }
+
+  decode_stream(&d, in);
+
+  if(d.npy) {
+    write_npy_header(&d);
+    fclose(d.spectrum_index);
+  }
+  fclose(d.spectrum);
+  fclose(d.digits);
+  fclose(d.peaks);
+  fclose(d.stats);
+  fclose(d.deadline);
+  if(in != stdin)
+    fclose(in);
+
+  fprintf(stderr, "%lu frames, %lu CRC errors, %lu sequence gaps, %lu bytes skipped\n",
+	  d.frames, d.crc_errors, d.sequence_gaps, d.skipped_bytes);
+  return d.crc_errors ? 1 : 0;
+}
@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////
+// Filename: wav_decode.c
+//
+// Synopsis: Offline decoder for recorded audio. Memory-maps a WAV or
+//           raw PCM16 file and streams it through a decoder instance
+//           in EDMA-frame-sized slices, writing one CSV line per digit.
+//
+// Usage:    wav_decode [-r rate] [-c channels] [-o events.csv] file
+//
+//           -r and -c describe raw files (default 8000 Hz, 1 channel);
+//           WAV files carry their own format. Left is channel 0; both
+//           channels are decoded in a DUAL_CHANNEL build.
+//
+///////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "config.h"
+#include "fft.h"
+#include "events.h"
+#include "arena.h"
+#include "decoder.h"
+#include "audio_file.h"
+
+static COMPLEX twiddle_factors[FFT_LENGTH];
+static decoder_t decoder;
+static double decoder_memory[DECODER_ARENA_BYTES / sizeof(double) + 1];
+
+static void write_event(void *context, const digit_event_t *event, double start, double end)
+{
+  fprintf((FILE *)context, "%u,%c,%.4f,%.4f,%u\n", event->channel, event->digit,
+	  start, end, event->confidence);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *path = NULL, *out_path = NULL;
+  audio_file_t audio;
+  struct timespec t0, t1;
+  uint64_t events;
+  double seconds;
+  FILE *out = stdout;
+  arena_t arena;
+  int i, raw_channels = 1;
+  double raw_rate = SAMPLING_FREQUENCY;
+
+  for(i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "-r") && i + 1 < argc)
+      raw_rate = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-c") && i + 1 < argc)
+      raw_channels = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-o") && i + 1 < argc)
+      out_path = argv[++i];
+    else if(argv[i][0] != '-' && !path)
+      path = argv[i];
+    else
+      path = NULL, i = argc;
+  }
+  if(!path || raw_channels < 1 || raw_channels > 2 || raw_rate <= 0) {
+    fprintf(stderr, "usage: %s [-r rate] [-c 1|2] [-o events.csv] file.wav|file.raw\n", argv[0]);
+    return 2;
+  }
+
+  if(open_audio(&audio, path, raw_rate, raw_channels) < 0)
+    return 1;
+  if(audio.rate > DECODER_MAX_SAMPLING_FREQUENCY)
+    fprintf(stderr, "warning: %.0f Hz is above the decoder's %d Hz limit\n",
+	    audio.rate, DECODER_MAX_SAMPLING_FREQUENCY);
+
+  if(out_path) {
+    out = fopen(out_path, "w");
+    if(!out) {
+      perror(out_path);
+      return 1;
+    }
+  }
+  fprintf(out, "channel,digit,start_s,end_s,confidence\n");
+
+  init_W(FFT_LENGTH, twiddle_factors);
+  init_arena(&arena, decoder_memory, sizeof(decoder_memory));
+  init_decoder(&decoder, &arena, audio.rate);
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  events = decode_audio(&decoder, &audio, 0, twiddle_factors, write_event, out);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+  fprintf(stderr, "%llu digits in %.1f s of audio, %.2f s (%.0fx real time)\n",
+	  (unsigned long long)events, audio.frames / audio.rate, seconds,
+	  seconds > 0 ? audio.frames / audio.rate / seconds : 0.0);
+
+  decoder_destroy(&decoder);
+  if(out != stdout)
+    fclose(out);
+  close_audio(&audio);
+  return 0;
+}
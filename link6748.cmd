@@ -9,7 +9,8 @@
 MEMORY
 {
     VECTORS:     o = 0x11800000  l = 0x00000200 // accessible by DSP and ARM
-    DSPRAM:      o = 0x11800200  l = 0x0003FE00 // accessible by DSP and ARM
+    DSPRAM:      o = 0x11800200  l = 0x00037E00 // accessible by DSP and ARM; the top
+                                                // 32 KB of L2 is cache (CACHE_L2_KB)
     SHAREDRAM:   o = 0x80000000  l = 0x00020000
     SDRAM:       o = 0xC0000000  l = 0x08000000 // external mDDR2
 }
@@ -23,9 +24,26 @@ SECTIONS
     .const      >   DSPRAM
     .stack      >   DSPRAM
     .sysmem     >   DSPRAM
+    // Real-time path (see placement.h): one block in call order, so it
+    // maps onto the direct-mapped L1P without evicting itself
+    .text:rt :
+    {
+        *ISRs.obj(.text:rt)
+        *decoder.obj(.text:rt)
+        *stft.obj(.text:rt)
+        *sdft.obj(.text:rt)
+        *fft.obj(.text:rt)
+        *peaks.obj(.text:rt)
+        *dtfm.obj(.text:rt)
+        *segmenter.obj(.text:rt)
+        *events.obj(.text:rt)
+        *(.text:rt)
+    } > DSPRAM, align(32)
     .text       >   DSPRAM
     .switch     >   DSPRAM
     .far        >   DSPRAM
+    "L2RAM"     >   DSPRAM      // hot data, see placement.h
 	"SHARED_SRAM" >   SHAREDRAM
-	"CE0"  >   SDRAM
+	"CE0"  >   SDRAM      // cold data, and hot data with PLACEMENT_SDRAM
+	.text:init  >   SDRAM     // start-up code
 }